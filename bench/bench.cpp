@@ -0,0 +1,221 @@
+// Microbenchmarks of the kernels of the genetic algorithm on random Euclidean instances of several sizes.
+// Every kernel is warmed up and then timed in samples of a calibrated number of calls, the standard output is a CSV
+// with the percentiles of the time of one call. Usage: bench [vertex count...]
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <random>
+
+#include "GraphMatrix.hpp"
+#include "graphGenerator.hpp"
+#include "Individual.hpp"
+#include "Crossover.hpp"
+#include "Selection.hpp"
+#include "GeneticAlgorithm.hpp"
+#include "FileUtils.hpp"
+
+static const int DEFAULT_SIZES[] = {14, 100, 500, 1000, 5000};
+// Calls of a sample are added until it takes at least this long
+static const long long MIN_SAMPLE_NS = 200000;
+static const long long WARMUP_NS = 50000000;
+// Sampling stops after MAX_SAMPLES or when MAX_KERNEL_NS is spent and there are at least MIN_SAMPLES
+static const int MIN_SAMPLES = 5;
+static const int MAX_SAMPLES = 51;
+static const long long MAX_KERNEL_NS = 2000000000;
+// Population of the algorithm used by the population kernels
+static const int POPULATION_COUNT = 256;
+static const char *GRAPH_FILE = "bench_graph.tmp";
+
+// Results of the kernels are added here, so that the compiler cannot remove the calls
+static volatile long long sink = 0;
+
+static long long nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Returns the time of `calls` calls of the kernel [ns]
+ *
+ * @param setup Called before every call of the kernel and not timed (may be empty)
+ */
+static long long timeCalls(const std::function<void()> &kernel, const std::function<void()> &setup, long calls)
+{
+    if (!setup)
+    {
+        const long long start = nowNs();
+        for (long i = 0; i < calls; ++i)
+        {
+            kernel();
+        }
+        return nowNs() - start;
+    }
+
+    long long elapsed = 0;
+    for (long i = 0; i < calls; ++i)
+    {
+        setup();
+        const long long start = nowNs();
+        kernel();
+        elapsed += nowNs() - start;
+    }
+    return elapsed;
+}
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+    return sorted[(size_t)(p * (sorted.size() - 1) + 0.5)];
+}
+
+static void run(std::string name, int vertexCount, const std::function<void()> &kernel, const std::function<void()> &setup = nullptr)
+{
+    fprintf(stderr, "%s, %i vertices\n", name.c_str(), vertexCount);
+
+    const long long warmupStart = nowNs();
+    while (nowNs() - warmupStart < WARMUP_NS)
+    {
+        timeCalls(kernel, setup, 1);
+    }
+
+    long calls = 1;
+    while (timeCalls(kernel, setup, calls) < MIN_SAMPLE_NS && calls < (1L << 30))
+    {
+        calls *= 2;
+    }
+
+    std::vector<double> samples;
+    const long long start = nowNs();
+    while ((int)samples.size() < MAX_SAMPLES && ((int)samples.size() < MIN_SAMPLES || nowNs() - start < MAX_KERNEL_NS))
+    {
+        samples.push_back(timeCalls(kernel, setup, calls) / (double)calls);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    printf("%s, %i, %zu, %li, %.1f, %.1f, %.1f, %.1f, %.1f, %.1f, %.1f\n", name.c_str(), vertexCount, samples.size(), calls,
+           samples.front(), percentile(samples, 0.1), percentile(samples, 0.25), percentile(samples, 0.5),
+           percentile(samples, 0.75), percentile(samples, 0.9), samples.back());
+    fflush(stdout);
+}
+
+// Writes the graph in the format read by FileUtils::loadGraph
+static void saveGraph(GraphMatrix *graph, const char *filePath)
+{
+    std::ofstream fout(filePath);
+    const int vertexCount = graph->getVertexCount();
+    fout << "bench" << vertexCount << "\n"
+         << vertexCount << "\n";
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        for (int j = 0; j < vertexCount; ++j)
+        {
+            fout << (i == j ? -1 : graph->getWeight(i, j)) << " ";
+        }
+        fout << "\n";
+    }
+    fout << 0 << "\n";
+}
+
+static void benchmarkSize(int vertexCount)
+{
+    GraphMatrix *graph = graphGenerator::getRandomEuclidean(vertexCount, 10000);
+    std::mt19937 rng(1);
+
+    Individual individual(vertexCount, graph);
+    individual.setRandomPath(rng);
+    run("update_path_weight", vertexCount, [&]()
+        { individual.updatePathWeight();
+          sink += individual.pathWeight; });
+
+    Individual parent1(vertexCount, graph);
+    Individual parent2(vertexCount, graph);
+    Individual child(vertexCount, graph);
+    parent1.setRandomPath(rng);
+    parent2.setRandomPath(rng);
+    parent1.updatePathWeight();
+    Crossover *crossover = Crossover::create("ox1", graph, NULL);
+    run("ox1_crossover", vertexCount, [&]()
+        { sink += crossover->crossover(parent1.path, parent1.pathWeight, parent2.path, child.path, rng); });
+    delete crossover;
+
+    AlgorithmParams params(1000, 0, 1.0, 1.0, POPULATION_COUNT);
+    params.seed = 1;
+    params.initializationThreadCount = 1;
+    GeneticAlgorithm algorithm(graph, params);
+    algorithm.initializePopulation();
+
+    run("inversion_mutation", vertexCount, [&]()
+        {
+            const int index1 = rng() % (vertexCount - 1);
+            const int index2 = index1 + 1 + rng() % (vertexCount - 1 - index1);
+            algorithm.inversionMutation(&individual, index1, index2);
+            sink += individual.pathWeight; });
+
+    std::vector<Individual *> population(POPULATION_COUNT);
+    for (int i = 0; i < POPULATION_COUNT; ++i)
+    {
+        population[i] = new Individual(vertexCount, graph);
+        population[i]->setRandomPath(rng);
+        population[i]->updatePathWeight();
+    }
+    Selection selection("tournament", 2, 1.5);
+    selection.prepare(population.data(), POPULATION_COUNT);
+    run("tournament_selection", vertexCount, [&]()
+        { sink += selection.select(population.data(), POPULATION_COUNT, rng); });
+    for (Individual *member : population)
+    {
+        delete member;
+    }
+
+    // Mutating the whole population (untimed) leaves it unsorted as after a generation
+    run("create_new_population", vertexCount, [&]()
+        { algorithm.createNewPopulation(); },
+        [&]()
+        { algorithm.executeMutations(); });
+
+    saveGraph(graph, GRAPH_FILE);
+    run("load_graph", vertexCount, [&]()
+        {
+            GraphMatrix *loaded = FileUtils::loadGraph(GRAPH_FILE);
+            sink += loaded->getVertexCount();
+            delete loaded; });
+    remove(GRAPH_FILE);
+
+    delete graph;
+}
+
+int main(int argc, char **argv)
+{
+    srand(1);
+
+    std::vector<int> sizes(DEFAULT_SIZES, DEFAULT_SIZES + sizeof(DEFAULT_SIZES) / sizeof(DEFAULT_SIZES[0]));
+    if (argc > 1)
+    {
+        sizes.clear();
+        for (int i = 1; i < argc; ++i)
+        {
+            sizes.push_back(atoi(argv[i]));
+        }
+    }
+
+    for (int vertexCount : sizes)
+    {
+        if (vertexCount < 8)
+        {
+            fprintf(stderr, "Instances need at least 8 vertices\n");
+            return 1;
+        }
+    }
+
+    printf("kernel, vertices, samples, calls per sample, min [ns], p10 [ns], p25 [ns], median [ns], p75 [ns], p90 [ns], max [ns]\n");
+    for (int vertexCount : sizes)
+    {
+        benchmarkSize(vertexCount);
+    }
+    return 0;
+}
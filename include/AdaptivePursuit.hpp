@@ -0,0 +1,53 @@
+#ifndef ADAPTIVE_PURSUIT_HPP
+#define ADAPTIVE_PURSUIT_HPP
+
+#include <vector>
+#include <random>
+
+// State of the adaptive parameter control after one generation
+struct AdaptationRecord
+{
+    int generation;
+    unsigned long timeMs;
+    int bestWeight;
+    float crossoverRate;
+    float mutationRate;
+    // Selection probabilities of the crossover operators (empty for a fixed operator)
+    std::vector<double> operatorProbabilities;
+};
+
+// Adaptive pursuit (Thierens) choosing one of several arms (operators or parameter values):
+// the estimated reward of the applied arm follows its rewards, the selection probability of the arm
+// with the best estimate is pushed towards maxProbability and of every other arm towards minProbability
+class AdaptivePursuit
+{
+private:
+    int armCount;
+    double minProbability;
+    double maxProbability;
+    // Adaptation rate of the reward estimates
+    double alpha;
+    // Learning rate of the probabilities
+    double beta;
+
+    std::vector<double> probabilities;
+    std::vector<double> estimates;
+
+public:
+    /**
+     * @param minShare Share of the selections spread evenly over all arms (every arm keeps minShare / armCount)
+     */
+    AdaptivePursuit(int armCount, double minShare, double alpha, double beta);
+
+    // Draws an arm with the current probabilities
+    int select(std::mt19937 &rng);
+
+    // Updates the estimates and the probabilities with the reward of the arm
+    void update(int arm, double reward);
+
+    int getArmCount();
+
+    const std::vector<double> &getProbabilities();
+};
+
+#endif
@@ -2,6 +2,10 @@
 #define GEN_ALG_PARAMS
 
 #include <iostream>
+#include <string>
+#include <vector>
+
+#include "Logger.hpp"
 
 struct AlgorithmParams
 {
@@ -17,6 +21,95 @@ struct AlgorithmParams
     // Algorithms stops when reaching the min error
     float minError;
 
+    // Engine solving the instance: "generational", "steady_state" or "lin_kernighan" (iterated Lin-Kernighan local search)
+    std::string engine = "generational";
+    // Instances with at most this many vertices are solved exactly by Held-Karp dynamic programming instead (0 - never)
+    int exactMaxSize = 24;
+    // Solve asymmetric instances as symmetric instances of twice as many vertices (Jonker-Volgenant transformation)
+    bool atspTransform = false;
+
+    // Parent selection: "tournament", "rank" or "roulette"
+    std::string selection = "tournament";
+    // Number of contestants in a tournament
+    int tournamentSize = 2;
+    // Expected number of offspring of the best individual in rank selection (1.0 - 2.0)
+    float selectionPressure = 1.5;
+
+    // Crossover operator: "ox1", "ox2", "pmx", "cx", "erx", "eax" (edge assembly crossover), "gpx" (partition crossover, both symmetric instances only)
+    // or "adaptive" (one of adaptiveOperators chosen by adaptive pursuit for every pair of children)
+    std::string crossover = "ox1";
+    std::vector<std::string> adaptiveOperators = {"ox1", "pmx", "erx", "eax"};
+    // Choose the crossover and mutation rates by adaptive pursuit in every generation
+    bool adaptiveRates = false;
+    // Path of the file with the trace of the adaptation (empty - not saved)
+    std::string adaptiveTrace = "";
+
+    // Mutation operator: "inversion" or "or_opt"
+    std::string mutation = "inversion";
+
+    // Construction heuristic seeding the initial population: "random", "nearest_neighbor", "greedy" or "space_filling_curve"
+    std::string initialization = "random";
+    // Share of the initial population created by the construction heuristic (the rest is random)
+    float initializationShare = 0.25;
+    // Number of threads creating the initial population (0 - all hardware threads)
+    int initializationThreadCount = 0;
+
+    // Reaction to stagnation (maxItersWithoutImprovment generations without improvement of the best weight or diversity
+    // below minDiversity): "none" (stop), "partial_reinit", "catastrophe" or "double_bridge"
+    std::string restart = "none";
+    // Minimum share of distinct path weights in the population (0 - diversity is not checked)
+    float minDiversity = 0.0;
+    // Share of the population (the worst individuals) created again by partial_reinit
+    float restartShare = 0.5;
+    // Number of best individuals kept by catastrophe and perturbed by double_bridge
+    int restartEliteCount = 4;
+
+    // Memetic stage: "none", "two_opt", "or_opt" or "lin_kernighan"
+    std::string localSearch = "none";
+    // Individuals improved by the local search: "offspring" (every child) or "elites" (best individuals after succession)
+    std::string localSearchTarget = "offspring";
+    // Maximum number of improving moves per individual (0 - until a local optimum)
+    int localSearchBudget = 0;
+    // Number of best individuals improved when localSearchTarget is "elites"
+    int eliteCount = 4;
+    // Number of nearest neighbors of every vertex considered by the local search
+    int candidateListSize = 8;
+    // Candidate lists: "nearest" (by weight) or "alpha" (alpha-nearness from the Held-Karp penalties, symmetric instances only)
+    std::string candidates = "nearest";
+    // Maximum number of 2-opt steps of a Lin-Kernighan move
+    int lkDepth = 5;
+    // Minimum number of vertices for which local search uses the two-level doubly-linked list tour (0 - never)
+    int twoLevelListMinSize = 10000;
+
+    // Compute a lower bound in parallel with the engine (1-tree subgradient optimization, assignment bound for .atsp)
+    bool lowerBound = true;
+    // Maximum number of subgradient iterations
+    int lowerBoundIterations = 1000;
+    // Engines stop when the gap between the best path and the lower bound is at most maxGap percent (negative - never)
+    float maxGap = 0.0;
+
+    // Number of generations (kicks of lin_kernighan) between progress lines, 0 - the engines print nothing while running
+    int progressInterval = 0;
+    // Read hardware performance counters (perf_event_open) in every phase of the generational GA and lin_kernighan
+    bool perfCounters = false;
+
+    // File of the convergence trace of the run (empty - not recorded), samples are taken every traceInterval generations
+    // (kicks of lin_kernighan) and whenever the best weight improves, up to traceCapacity latest samples are kept
+    std::string traceFile = "";
+    int traceInterval = 100;
+    int traceCapacity = 100000;
+
+    // Seed of the random number generator (0 - seed drawn from rand())
+    unsigned int seed = 0;
+
+    // Parallel execution (island model)
+    // Number of worker threads (islands), 1 runs a single GA in the calling thread
+    int threadCount = 1;
+    // Pin workers to cores and allocate each island's population on the worker's own node
+    bool numaAware = true;
+    // Give every NUMA node its own copy of the distance matrix
+    bool replicateGraph = false;
+
     AlgorithmParams(){};
 
     AlgorithmParams(
@@ -28,17 +121,17 @@ struct AlgorithmParams
     {
         if (populationCount % 4 != 0)
         {
-            printf("Population count must be divisible by 4.\n");
+            LOG_ERROR("settings", "Population count must be divisible by 4.");
             exit(0);
         }
         if (crossoverProbability < 0 || crossoverProbability > 1.0)
         {
-            printf("Crossover probability must be between 0 and 1\n");
+            LOG_ERROR("settings", "Crossover probability must be between 0 and 1");
             exit(0);
         }
         if (mutationProbability < 0 || mutationProbability > 1.0)
         {
-            printf("Mutation probability must be between 0 and 1\n");
+            LOG_ERROR("settings", "Mutation probability must be between 0 and 1");
             exit(0);
         }
 
@@ -57,14 +150,52 @@ struct AlgorithmParams
 
     void print()
     {
-        printf("max execution time: %i\n", maxExecutionTimeMs);
-        printf("max iters w/out improv: %i\n", maxItersWithoutImprovment);
-        printf("crossover probab: %.4f\n", crossoverProbability);
-        printf("mutation probab: %.4f\n", mutationProbability);
-        printf("population count: %i\n", populationCount);
-        printf("next gen population count %i\n", nextGenPopulationCount);
-        printf("mating pool size: %i\n", matingPoolSize);
-        printf("min error: %.4f\n", minError);
+        LOG_INFO("params", "max execution time: %i", maxExecutionTimeMs);
+        LOG_INFO("params", "max iters w/out improv: %i", maxItersWithoutImprovment);
+        LOG_INFO("params", "crossover probab: %.4f", crossoverProbability);
+        LOG_INFO("params", "mutation probab: %.4f", mutationProbability);
+        LOG_INFO("params", "population count: %i", populationCount);
+        LOG_INFO("params", "next gen population count %i", nextGenPopulationCount);
+        LOG_INFO("params", "mating pool size: %i", matingPoolSize);
+        LOG_INFO("params", "min error: %.4f", minError);
+        LOG_INFO("params", "engine: %s", engine.c_str());
+        LOG_INFO("params", "exact max size: %i", exactMaxSize);
+        LOG_INFO("params", "atsp transform: %s", atspTransform ? "true" : "false");
+        LOG_INFO("params", "selection: %s", selection.c_str());
+        LOG_INFO("params", "tournament size: %i", tournamentSize);
+        LOG_INFO("params", "selection pressure: %.4f", selectionPressure);
+        LOG_INFO("params", "crossover: %s", crossover.c_str());
+        std::string operators;
+        for (const std::string &name : adaptiveOperators)
+            operators += " " + name;
+        LOG_INFO("params", "adaptive operators:%s", operators.c_str());
+        LOG_INFO("params", "adaptive rates: %s", adaptiveRates ? "true" : "false");
+        LOG_INFO("params", "mutation: %s", mutation.c_str());
+        LOG_INFO("params", "initialization: %s", initialization.c_str());
+        LOG_INFO("params", "initialization share: %.4f", initializationShare);
+        LOG_INFO("params", "initialization thread count: %i", initializationThreadCount);
+        LOG_INFO("params", "restart: %s", restart.c_str());
+        LOG_INFO("params", "min diversity: %.4f", minDiversity);
+        LOG_INFO("params", "restart share: %.4f", restartShare);
+        LOG_INFO("params", "restart elite count: %i", restartEliteCount);
+        LOG_INFO("params", "local search: %s", localSearch.c_str());
+        LOG_INFO("params", "local search target: %s", localSearchTarget.c_str());
+        LOG_INFO("params", "local search budget: %i", localSearchBudget);
+        LOG_INFO("params", "elite count: %i", eliteCount);
+        LOG_INFO("params", "candidate list size: %i", candidateListSize);
+        LOG_INFO("params", "candidates: %s", candidates.c_str());
+        LOG_INFO("params", "lk depth: %i", lkDepth);
+        LOG_INFO("params", "two-level list min size: %i", twoLevelListMinSize);
+        LOG_INFO("params", "lower bound: %s", lowerBound ? "true" : "false");
+        LOG_INFO("params", "lower bound iterations: %i", lowerBoundIterations);
+        LOG_INFO("params", "max gap: %.4f", maxGap);
+        LOG_INFO("params", "progress interval: %i", progressInterval);
+        LOG_INFO("params", "perf counters: %s", perfCounters ? "true" : "false");
+        LOG_INFO("params", "trace interval: %i", traceInterval);
+        LOG_INFO("params", "trace capacity: %i", traceCapacity);
+        LOG_INFO("params", "thread count: %i", threadCount);
+        LOG_INFO("params", "numa aware: %s", numaAware ? "true" : "false");
+        LOG_INFO("params", "replicate graph: %s", replicateGraph ? "true" : "false");
     }
 };
 
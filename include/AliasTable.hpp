@@ -0,0 +1,32 @@
+#ifndef ALIAS_TABLE_HPP
+#define ALIAS_TABLE_HPP
+
+#include <vector>
+#include <random>
+
+// Walker's alias table (Vose's construction) for sampling indices from a discrete distribution in O(1)
+class AliasTable
+{
+private:
+    std::vector<double> probability;
+    std::vector<int> alias;
+
+    // Work lists used during the construction (kept to avoid allocations on rebuild)
+    std::vector<int> small;
+    std::vector<int> large;
+    std::vector<double> scaled;
+
+public:
+    /**
+     * @brief Builds the table in O(n) for the given non-negative weights
+     * (uniform distribution if all weights are 0)
+     */
+    void build(const std::vector<double> &weights);
+
+    // Returns a random index with probability proportional to its weight
+    int sample(std::mt19937 &rng);
+
+    int size();
+};
+
+#endif
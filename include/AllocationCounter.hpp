@@ -0,0 +1,27 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+// Heap allocations of the calling thread, counted by the replaced global operator new (every allocation of the
+// program goes through it, the count is a thread-local increment), and the memory usage of the process
+namespace AllocationCounter
+{
+    // Allocations and bytes requested by the calling thread since it started
+    unsigned long long getAllocations();
+    unsigned long long getAllocatedBytes();
+
+    // Resets the peak resident set size of the process (Linux 4.0+), returns false if it could not be reset
+    bool resetPeakRss();
+
+    // Peak resident set size of the process [kB] since the start or the last resetPeakRss(), -1 - unknown
+    long long getPeakRssKb();
+
+    /**
+     * @brief Reads the memory of the allocator (glibc malloc, all arenas), both -1 if unknown
+     *
+     * @param arenaBytes Bytes the allocator got from the system, without the chunks mapped separately
+     * @param inUseBytes Bytes of allocated chunks, including the ones mapped separately
+     */
+    void getArenaUsage(long long &arenaBytes, long long &inUseBytes);
+}
+
+#endif
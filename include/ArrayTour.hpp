@@ -0,0 +1,45 @@
+#ifndef ARRAY_TOUR_HPP
+#define ARRAY_TOUR_HPP
+
+#include <vector>
+#include "Tour.hpp"
+
+// Tour stored as an array of vertices with an inverse (position) array.
+// next / prev / between are O(1), reversing a segment is O(n) (the shorter side of the tour is reversed).
+class ArrayTour : public Tour
+{
+private:
+    int vertexCount = 0;
+    std::vector<int> order;
+    std::vector<int> position;
+
+public:
+    ArrayTour();
+    ArrayTour(int vertexCount);
+
+    // Loads the tour from a path of vertexCount vertices
+    void load(const int *path) override;
+
+    // Writes the tour into path (starting from the vertex at position 0)
+    void store(int *path) override;
+
+    int next(int v) override;
+    int prev(int v) override;
+
+    // Returns true if b lies on the tour walking forward from a to c (a, b and c inclusive)
+    bool between(int a, int b, int c) override;
+
+    // Reverses the part of the tour walking forward from vertex `from` to vertex `to`
+    void reverse(int from, int to) override;
+
+    /**
+     * @brief Moves the segment walking forward from `first` to `last` between vertex `after` and its successor,
+     * keeping the orientation of the segment (`after` must not be in the segment).
+     * Costs O(min(distance from the segment to `after`, distance from `after` to the segment))
+     */
+    void moveSegment(int first, int last, int after) override;
+
+    int getVertexCount() override;
+};
+
+#endif
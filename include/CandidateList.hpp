@@ -0,0 +1,37 @@
+#ifndef CANDIDATE_LIST_HPP
+#define CANDIDATE_LIST_HPP
+
+#include <vector>
+#include "GraphMatrix.hpp"
+
+// Lists of the k nearest vertices of every vertex (candidates for new edges in local search)
+class CandidateList
+{
+private:
+    int vertexCount;
+    int size;
+    // neighbors[v * size + i] is the i-th nearest vertex of v
+    std::vector<int> neighbors;
+
+public:
+    CandidateList();
+
+    /**
+     * @brief Builds lists of the k nearest vertices by the weight of the edge from the vertex
+     * (or to the vertex, if incoming is true)
+     *
+     * @param k Number of candidates of every vertex (limited to vertexCount - 1)
+     */
+    CandidateList(GraphMatrix *graph, int k, bool incoming = false);
+
+    // Takes lists selected by another measure, neighbors[v * size + i] is the i-th candidate of v
+    CandidateList(int vertexCount, int size, std::vector<int> neighbors);
+
+    // Returns the number of candidates of every vertex
+    int getSize();
+
+    // Returns pointer to the candidates of vertex v, sorted from the nearest
+    const int *get(int v);
+};
+
+#endif
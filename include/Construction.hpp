@@ -0,0 +1,91 @@
+#ifndef CONSTRUCTION_HPP
+#define CONSTRUCTION_HPP
+
+#include <string>
+#include <vector>
+#include <random>
+#include <utility>
+
+#include "GraphMatrix.hpp"
+#include "CandidateList.hpp"
+
+// Randomized construction heuristics seeding the initial population
+//   nearest_neighbor    - from a random vertex always go to the nearest unvisited vertex
+//                         (sometimes to the second nearest one)
+//   greedy              - add the shortest candidate edges which keep every fragment a path (some edges are skipped
+//                         at random), then join the fragments by nearest neighbor
+//   space_filling_curve - visit the vertices in the order of a Hilbert curve laid over their coordinates
+//                         (randomly shifted and mirrored), nearest_neighbor for instances without coordinates
+// All buffers are allocated once, so one object must not be used by several threads at the same time.
+class Construction
+{
+private:
+    GraphMatrix *graph;
+    // Nearest vertices by the weight of the edge from the vertex
+    CandidateList *candidates;
+    int vertexCount;
+
+    // Unvisited vertices (the first unvisitedCount of them) and their indices in the array
+    std::vector<int> unvisited;
+    std::vector<int> unvisitedIndex;
+    int unvisitedCount = 0;
+
+    // Candidate edges (from, to) sorted by weight, for symmetric graphs only with from < to
+    std::vector<std::pair<int, int>> candidateEdges;
+
+    // Fragments of the greedy construction: neighbors of every vertex (symmetric graphs) or successor and
+    // predecessor (asymmetric graphs), -1 if none
+    std::vector<int> link;
+    // Union-find forest of the fragments
+    std::vector<int> fragment;
+
+    // Hilbert curve index and vertex
+    std::vector<std::pair<unsigned long long, int>> curveOrder;
+
+    void resetUnvisited();
+
+    void visit(int v);
+
+    // Returns the nearest unvisited vertex from v (-1 if all vertices are visited)
+    int nearestUnvisited(int v);
+
+    int findFragment(int v);
+
+    void greedySymmetric(int *path, std::mt19937 &rng);
+
+    void greedyAsymmetric(int *path, std::mt19937 &rng);
+
+    // Writes the fragment starting at its end `first` to path from index k, marks it as visited, returns its other end
+    int appendFragment(int first, int *path, int &k);
+
+public:
+    // Probability of going to the second nearest instead of the nearest unvisited vertex
+    static constexpr double NEAREST_NEIGHBOR_RANDOMIZATION = 0.1;
+    // Probability of skipping a candidate edge in the greedy construction
+    static constexpr double GREEDY_RANDOMIZATION = 0.1;
+    // Side of the Hilbert curve grid (power of 2)
+    static const unsigned int CURVE_GRID_SIZE = 1 << 16;
+
+    Construction(GraphMatrix *graph, CandidateList *candidates);
+
+    /**
+     * @brief Fills path with a tour constructed with the given method
+     *
+     * @param method "nearest_neighbor", "greedy" or "space_filling_curve"
+     */
+    void construct(std::string method, int *path, std::mt19937 &rng);
+
+    void nearestNeighbor(int *path, std::mt19937 &rng);
+
+    void greedyEdge(int *path, std::mt19937 &rng);
+
+    void spaceFillingCurve(int *path, std::mt19937 &rng);
+
+    // Returns true if the method name is known ("random" included)
+    static bool isValidMethod(std::string method);
+
+    // Returns the index of point (x, y) on the Hilbert curve filling a gridSize x gridSize grid
+    static unsigned long long hilbertIndex(unsigned int gridSize, unsigned int x, unsigned int y);
+};
+
+#endif
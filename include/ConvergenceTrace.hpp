@@ -0,0 +1,47 @@
+#ifndef CONVERGENCE_TRACE_HPP
+#define CONVERGENCE_TRACE_HPP
+
+#include <vector>
+#include <cstddef>
+
+// State of a run at one moment
+struct TraceSample
+{
+    unsigned long long timeNs;
+    // Generation (kick of the Lin-Kernighan engine)
+    unsigned long long generation;
+    int bestWeight;
+    double meanWeight;
+    // Share of distinct path weights in the population
+    float diversity;
+};
+
+// Samples of the convergence of a run in a ring buffer allocated by reset(), record() never allocates.
+// When the buffer is full the oldest samples are overwritten.
+class ConvergenceTrace
+{
+private:
+    std::vector<TraceSample> samples;
+    // Position of the next sample and the number of samples recorded since reset()
+    size_t next = 0;
+    unsigned long long recordedCount = 0;
+
+public:
+    // Allocates the buffer for capacity samples (0 - nothing is recorded)
+    void reset(int capacity);
+
+    void record(const TraceSample &sample);
+
+    bool isEnabled();
+
+    // Returns the kept samples from the oldest one
+    std::vector<TraceSample> getSamples();
+
+    // Returns the number of overwritten samples
+    unsigned long long getDroppedCount();
+
+    // Returns the time of the first sample with the best weight at most targetWeight [ns], -1 if there is none
+    static long long timeToTarget(const std::vector<TraceSample> &samples, int targetWeight);
+};
+
+#endif
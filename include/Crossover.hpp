@@ -0,0 +1,70 @@
+#ifndef CROSSOVER_HPP
+#define CROSSOVER_HPP
+
+#include <string>
+#include <vector>
+#include <random>
+
+#include "GraphMatrix.hpp"
+#include "CandidateList.hpp"
+
+// Crossover operator creating one child from two parents.
+// Every operator keeps its own preallocated buffers, so one object must not be used by several threads at the same time
+// (each thread creates its own operator).
+class Crossover
+{
+protected:
+    GraphMatrix *graph;
+    int vertexCount;
+
+    // Vertex v is marked if mark[v] == stamp, incrementing the stamp unmarks all vertices in O(1)
+    std::vector<unsigned int> mark;
+    unsigned int stamp = 0;
+
+    Crossover(GraphMatrix *graph);
+
+    // Unmarks all vertices
+    void clearMarks();
+
+    // Returns the weight of the path
+    int evaluate(const int *path);
+
+    // Random int from min (inclusive) to max (inclusive)
+    int randomInt(std::mt19937 &rng, int min, int max);
+
+public:
+    virtual ~Crossover() {}
+
+    /**
+     * @brief Creates one child from two parents
+     *
+     * @param parent1 Path of the first parent
+     * @param parent1Weight Weight of parent1 (used by operators computing the child weight from exchanged edges)
+     * @param parent2 Path of the second parent
+     * @param child Output path of vertexCount vertices
+     * @return Weight of the child
+     */
+    virtual int crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &rng) = 0;
+
+    /**
+     * @brief Creates the operator with the given name
+     * (eax needs a symmetric graph and candidate lists, gpx a symmetric graph, otherwise ox1 is created instead)
+     *
+     * @param candidates Nearest neighbors of every vertex, may be NULL for operators other than eax
+     */
+    static Crossover *create(std::string name, GraphMatrix *graph, CandidateList *candidates);
+
+    // Returns true if the operator with the given name uses candidate lists on this graph
+    static bool needsCandidates(std::string name, GraphMatrix *graph);
+
+    // Returns true if the operator works with undirected edges (falls back to ox1 on asymmetric graphs)
+    static bool needsSymmetricGraph(std::string name);
+
+    // Names of all operators
+    static const std::vector<std::string> &getNames();
+
+    // Returns true if the operator name is known
+    static bool isValidName(std::string name);
+};
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef CYCLE_CROSSOVER_HPP
+#define CYCLE_CROSSOVER_HPP
+
+#include "Crossover.hpp"
+
+// CX (cycle crossover): positions are split into cycles (positions whose vertices of parent1 and parent2
+// are the same sets), the child takes the cycles alternately from parent1 and parent2, so every vertex keeps
+// its position from one of the parents
+class CycleCrossover : public Crossover
+{
+private:
+    // Index of every vertex in parent1
+    std::vector<int> position;
+
+public:
+    CycleCrossover(GraphMatrix *graph);
+
+    int crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &rng) override;
+};
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef DEADLINE_HPP
+#define DEADLINE_HPP
+
+#include <chrono>
+
+// Execution time limit checked from a hot loop. The end time is computed once by start() and the monotonic clock is
+// read only every stride calls of isReached(). The stride doubles while the reads are closer than CHECK_PERIOD_NS
+// and halves when they are further apart, so the limit is overshot by about CHECK_PERIOD_NS whatever an iteration costs.
+class Deadline
+{
+private:
+    std::chrono::steady_clock::time_point end;
+    std::chrono::steady_clock::time_point lastCheck;
+    int stride = 1;
+    int callsUntilCheck = 1;
+    bool reached = false;
+
+public:
+    // Target time between two reads of the clock
+    static const long CHECK_PERIOD_NS = 1000000;
+    static const int MAX_STRIDE = 1 << 16;
+
+    /**
+     * @param limitMs Time from now after which isReached() returns true
+     */
+    void start(unsigned long limitMs);
+
+    bool isReached();
+};
+
+#endif
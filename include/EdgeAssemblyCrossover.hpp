@@ -0,0 +1,72 @@
+#ifndef EDGE_ASSEMBLY_CROSSOVER_HPP
+#define EDGE_ASSEMBLY_CROSSOVER_HPP
+
+#include "Crossover.hpp"
+
+// Edge Assembly Crossover (EAX) for symmetric instances.
+// Edges of the two parents that are not shared are split into AB-cycles (cycles alternating between
+// an edge of parent A and an edge of parent B). The child is parent A with the edges of one random AB-cycle
+// exchanged for the edges of parent B, which leaves a set of subtours. Subtours are merged greedily,
+// always the smallest one into its neighbor, by the cheapest exchange of two edges found in the candidate lists.
+// The child keeps almost all edges of its parents, unlike order based crossovers.
+class EdgeAssemblyCrossover : public Crossover
+{
+private:
+    CandidateList *candidates;
+
+    // Neighbors of every vertex in parent A, parent B and in the child (link[2 * v], link[2 * v + 1])
+    std::vector<int> linkA;
+    std::vector<int> linkB;
+    std::vector<int> link;
+
+    // Edges of the parents not found in the other parent, not yet used by an AB-cycle (-1 - no edge)
+    std::vector<int> restA;
+    std::vector<int> restB;
+    std::vector<int> restCountA;
+
+    // Vertices of the current walk and their positions in it (-1 - not on the walk)
+    std::vector<int> walk;
+    std::vector<int> evenPosition;
+    std::vector<int> oddPosition;
+
+    // Vertices of all AB-cycles, cycle i is cycleVertices[cycleStart[i]] .. cycleVertices[cycleStart[i + 1] - 1]
+    // and starts with an edge of parent A
+    std::vector<int> cycleVertices;
+    std::vector<int> cycleStart;
+
+    // Subtour of every vertex of the intermediate solution
+    std::vector<int> subtour;
+    std::vector<int> subtourSize;
+    std::vector<int> subtourVertex;
+    std::vector<int> subtourVertices;
+
+    // Fills linkX with the neighbors of every vertex in the path
+    void setLinks(const int *path, std::vector<int> &linkX);
+
+    // Splits the edges in which the parents differ into AB-cycles
+    void buildCycles(std::mt19937 &rng);
+
+    // Removes the edge u-v from the rest of the parent edges
+    void removeRestEdge(std::vector<int> &rest, int u, int v);
+
+    // Exchanges the edges of parent A in the cycle for the edges of parent B, returns the change of weight
+    int applyCycle(int cycle);
+
+    // Labels the subtours of the intermediate solution, returns their number
+    int findSubtours();
+
+    // Merges the smallest subtour with another one, returns the change of weight
+    int mergeSmallestSubtour();
+
+    // Replaces neighbor `from` of vertex v with `to`
+    void replaceLink(int v, int from, int to);
+
+public:
+    EdgeAssemblyCrossover(GraphMatrix *graph, CandidateList *candidates);
+
+    // The child is based on parentA and gets the edges of parentB of one AB-cycle.
+    // Its weight is computed from the exchanged edges, without evaluating the whole path.
+    int crossover(const int *parentA, int parentAWeight, const int *parentB, int *child, std::mt19937 &rng) override;
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef EDGE_RECOMBINATION_CROSSOVER_HPP
+#define EDGE_RECOMBINATION_CROSSOVER_HPP
+
+#include "Crossover.hpp"
+
+// ERX (edge recombination crossover): the child is built from the union of the (undirected) edges of the parents.
+// The next vertex is the neighbor of the current one with the fewest neighbors left (ties broken randomly),
+// a random unvisited vertex is taken only when the current vertex has no unvisited neighbors.
+class EdgeRecombinationCrossover : public Crossover
+{
+private:
+    static const int MAX_NEIGHBORS = 4;
+
+    // Flat adjacency table, neighbors of v are neighbors[MAX_NEIGHBORS * v] .. (neighborCount[v] of them)
+    std::vector<int> neighbors;
+    std::vector<int> neighborCount;
+
+    // Unvisited vertices (the first unvisitedCount of them) and their indices in the array
+    std::vector<int> unvisited;
+    std::vector<int> unvisitedIndex;
+
+    // Adds u to the neighbors of v (once)
+    void addNeighbor(int v, int u);
+
+    // Removes u from the neighbors of v
+    void removeNeighbor(int v, int u);
+
+public:
+    EdgeRecombinationCrossover(GraphMatrix *graph);
+
+    int crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &rng) override;
+};
+
+#endif
@@ -4,6 +4,12 @@
 #include <string>
 #include "GraphMatrix.hpp"
 #include "TestResult.hpp"
+#include "IslandModel.hpp"
+#include "AlgorithmParams.hpp"
+#include "AdaptivePursuit.hpp"
+#include "Portfolio.hpp"
+#include "ConvergenceTrace.hpp"
+#include "RegressionSample.hpp"
 
 class FileUtils
 {
@@ -16,6 +22,14 @@ public:
      */
     static GraphMatrix *loadGraph(std::string fileName);
 
+    /**
+     * @brief Loads a tour from a TSPLIB .tour file (TOUR_SECTION with 1-based vertices ended with -1)
+     *
+     * @param filePath Path of the tour file
+     * @return 0-based vertices of the tour (empty if the file could not be read)
+     */
+    static std::vector<int> loadTour(std::string filePath);
+
     /**
      * @brief Writes header for the result file of single instance test
      *
@@ -34,6 +48,162 @@ public:
      */
     static void appendTestResult(std::string filePath, TestResult testResult);
 
+    /**
+     * @brief Writes header for the result file of the NUMA placement benchmark
+     *
+     * @param filePath Output file path
+     */
+    static void writeNumaBenchmarkHeader(std::string filePath);
+
+    /**
+     * @brief Appends one row for every NUMA node of a single benchmark run
+     *
+     * @param placement Name of the placement strategy ("naive" or "numa_aware")
+     * @param threadCount Number of islands
+     * @param nodeStatistics Per node statistics of the run
+     */
+    static void appendNumaBenchmarkResult(std::string filePath, TestResult testResult, std::string placement, int threadCount, std::vector<NodeStatistics> nodeStatistics);
+
+    static void writeOptTourCheckHeader(std::string filePath);
+
+    /**
+     * @brief Save result of comparing the Lin-Kernighan solver with the optimal tour
+     *
+     * @param optTourWeight Weight of the tour from the .opt.tour file
+     * @param averageStepNs Average time of one improvement step of the local search
+     */
+    static void appendOptTourCheckResult(std::string filePath, TestResult testResult, int optTourWeight, unsigned long long improvingMoves, double averageStepNs);
+
+    static void writeCrossoverBenchmarkHeader(std::string filePath);
+
+    /**
+     * @brief Save result of a single run of the crossover benchmark
+     *
+     * @param crossover Name of the crossover ("ox" or "eax")
+     * @param targetPrd Error at which the run stops
+     * @param reached true if the run stopped at the target error, false if at the time limit
+     * @param evaluations Number of path evaluations of the run
+     */
+    static void appendCrossoverBenchmarkResult(std::string filePath, TestResult testResult, std::string crossover, float targetPrd, bool reached, unsigned long long evaluations);
+
+    static void writeCrossoverThroughputHeader(std::string filePath);
+
+    /**
+     * @brief Save results of one crossover operator in the throughput benchmark
+     *
+     * @param weightRatio Average ratio of the child weight to the average weight of its parents
+     * @param betterPercent Percentage of children better than both parents
+     * @param inheritedPercent Percentage of the edges of children found in one of the parents
+     */
+    static void appendCrossoverThroughputResult(std::string filePath, std::string instanceName, int vertexCount, std::string crossover, int childCount,
+                                                double childrenPerSecond, double averageParentsWeight, double averageChildWeight,
+                                                double weightRatio, double betterPercent, double inheritedPercent);
+
+    static void writeInitializationBenchmarkHeader(std::string filePath);
+
+    /**
+     * @brief Save result of a single run of the initialization benchmark
+     *
+     * @param params Parameters of the run (initialization method and share)
+     * @param initializationTimeNs Time of creating the initial population
+     * @param initialPrd Error of the best individual of the initial population
+     * @param targetPrd Error at which the run stops
+     * @param reached true if the run stopped at the target error, false if at the time limit
+     */
+    static void appendInitializationBenchmarkResult(std::string filePath, TestResult testResult, AlgorithmParams params, unsigned long initializationTimeNs,
+                                                    float initialPrd, float targetPrd, bool reached, unsigned long long evaluations);
+
+    static void writePortfolioHeader(std::string filePath);
+
+    /**
+     * @brief Save the budget and result of every configuration of one portfolio run
+     *
+     * @param run Number of the run on the instance
+     * @param path Best path of the run (lower bound and gap are saved with every configuration)
+     */
+    static void appendPortfolioResult(std::string filePath, std::string instanceName, int run, Path path, std::vector<PortfolioRecord> records);
+
+    static void writeAtspTransformBenchmarkHeader(std::string filePath);
+
+    /**
+     * @brief Save result of a single run of the ATSP transformation benchmark
+     *
+     * @param params Parameters of the run (engine and atspTransform)
+     * @param targetPrd Error at which the run stops
+     * @param reached true if the run stopped at the target error
+     */
+    static void appendAtspTransformBenchmarkResult(std::string filePath, TestResult testResult, AlgorithmParams params, float targetPrd, bool reached);
+
+    /**
+     * @brief Save the state of the adaptive parameter control after every generation
+     *
+     * @param operatorNames Names of the operators of the adaptive crossover (empty for a fixed operator)
+     */
+    static void writeAdaptationTrace(std::string filePath, std::vector<std::string> operatorNames, std::vector<AdaptationRecord> records);
+
+    /**
+     * @brief Saves the convergence trace of a run
+     *
+     * @param droppedCount Number of the oldest samples overwritten in the ring buffer
+     */
+    static void writeConvergenceTrace(std::string filePath, std::vector<TraceSample> samples, unsigned long long droppedCount);
+
+    /**
+     * @brief Loads a convergence trace saved by writeConvergenceTrace
+     *
+     * @return Samples of the trace (empty if the file could not be read)
+     */
+    static std::vector<TraceSample> loadConvergenceTrace(std::string filePath);
+
+    /**
+     * @brief Writes header for the time-to-target file
+     */
+    static void writeTimeToTargetHeader(std::string filePath);
+
+    /**
+     * @brief Appends the time of a run to reach the target and its probability in the empirical distribution
+     */
+    static void appendTimeToTarget(std::string filePath, float targetPrd, int targetWeight, int run, double timeMs, double probability);
+
+    /**
+     * @brief Saves the runs of the regression harness as its baseline
+     */
+    static void writeRegressionBaseline(std::string filePath, std::vector<RegressionSample> samples);
+
+    /**
+     * @brief Loads a baseline saved by writeRegressionBaseline
+     *
+     * @return Runs of the baseline (empty if the file could not be read)
+     */
+    static std::vector<RegressionSample> loadRegressionBaseline(std::string filePath);
+
+    /**
+     * @brief Writes header for the result file of the regression harness
+     */
+    static void writeRegressionHeader(std::string filePath);
+
+    /**
+     * @brief Appends the comparison of one metric of an instance with the baseline
+     *
+     * @param metric Name of the compared metric
+     * @param pValue p-value of the test of the current runs being worse than the baseline
+     */
+    static void appendRegressionResult(std::string filePath, std::string instanceName, std::string metric, int baselineCount, int currentCount,
+                                       double baselineMedian, double currentMedian, double u, double pValue, bool regression);
+
+    /**
+     * @brief Writes header for the result file of the allocation check
+     */
+    static void writeAllocationCheckHeader(std::string filePath);
+
+    /**
+     * @brief Appends the allocations of the checked generations of an instance
+     *
+     * @param phaseAllocations Allocations of every phase (PHASE_COUNT values)
+     */
+    static void appendAllocationCheckResult(std::string filePath, std::string instanceName, int vertexCount, int warmupGenerations, int generationCount,
+                                            unsigned long long allocations, unsigned long long bytes, std::vector<unsigned long long> phaseAllocations);
+
     static void appendRandomInstanceTestResult(std::string filePath, int vertexCount, unsigned long elapsedTime);
     static void writeRandomInstanceTestHeader(std::string filePath);
 
@@ -43,6 +213,17 @@ public:
      * @param path Path vertices
      */
     static std::string pathToStr(std::vector<int> path);
+
+    /**
+     * @brief Returns the names of the columns written by profileToStr
+     */
+    static std::string profileHeader();
+
+    /**
+     * @brief Returns the generations, evaluations, evaluations per second, the time, calls and evaluations
+     * of every phase and the hardware events of every phase as comma separated columns
+     */
+    static std::string profileToStr(const PhaseProfile &profile);
 };
 
 #endif
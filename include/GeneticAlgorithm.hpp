@@ -4,12 +4,24 @@
 #include <vector>
 #include <climits>
 #include <iostream>
+#include <random>
+#include <atomic>
 
 #include "GraphMatrix.hpp"
 #include "Individual.hpp"
 #include "Path.hpp"
 #include "Timer.hpp"
+#include "Deadline.hpp"
+#include "ConvergenceTrace.hpp"
 #include "AlgorithmParams.hpp"
+#include "Selection.hpp"
+#include "CandidateList.hpp"
+#include "TwoOpt.hpp"
+#include "OrOpt.hpp"
+#include "LinKernighan.hpp"
+#include "Crossover.hpp"
+#include "LowerBound.hpp"
+#include "AdaptivePursuit.hpp"
 
 class GeneticAlgorithm
 {
@@ -27,22 +39,109 @@ private:
     // Array of individuals in the mating pool
     Individual **matingPool;
 
+    Selection selection;
+
+    // Nearest neighbors used by the local search and EAX (NULL when neither is used)
+    CandidateList *candidates = NULL;
+    CandidateList *inCandidates = NULL;
+    TwoOpt *twoOpt = NULL;
+    OrOpt *orOpt = NULL;
+    LinKernighan *lk = NULL;
+
+    // Fixed crossover operator (NULL for the adaptive crossover)
+    Crossover *crossover = NULL;
+
+    // Operators of the adaptive crossover and the pursuit choosing between them
+    std::vector<Crossover *> adaptiveCrossovers;
+    std::vector<std::string> adaptiveCrossoverNames;
+    AdaptivePursuit *operatorPursuit = NULL;
+    // Pursuits choosing the crossover and mutation rates (NULL for fixed rates), arms applied in the current generation
+    AdaptivePursuit *crossoverRatePursuit = NULL;
+    AdaptivePursuit *mutationRatePursuit = NULL;
+    int crossoverRateArm = -1;
+    int mutationRateArm = -1;
+    // Mean weight of the population and the evaluation count at the start of the current generation
+    double generationStartMeanWeight = 0.0;
+    unsigned long long generationStartEvaluations = 0;
+
+    // Number of children and mutation probability of the current generation
+    int childCount;
+    float mutationProbability;
+
+    int generation = 0;
+    // Ring buffer of the last generations of the adaptation trace, preallocated in start()
+    std::vector<AdaptationRecord> adaptationTrace;
+    unsigned long adaptationRecordCount = 0;
+
     std::vector<Individual *> jointPopul;
 
+    // Vertices seen by pathIsValid
+    std::vector<char> visited;
+
+    // Contiguous storage for the paths of population and nextGenPopulation
+    int *pathArena;
+
     Individual *fittestIndividual = NULL;
 
     Timer timer;
+    Deadline deadline;
+
+    std::mt19937 rng;
+
+    // Number of path weight evaluations done so far
+    unsigned long long evaluationCount = 0;
+
+    // Time and evaluations of the phases of the generations
+    PhaseProfile profile;
+    // Hardware counters of the thread running the algorithm, open from start() to finish() if params.perfCounters is set
+    PerfCounters perfCounters;
+
+    // Samples of the best weight over time (recorded only if params.traceFile is set) and the best weight of the last sample
+    ConvergenceTrace convergenceTrace;
+    int tracedBestWeight = INT_MAX;
+
+    // Time of creating the initial population and the weight of its best individual
+    unsigned long initializationTimeNs = 0;
+    int initialBestWeight = 0;
+
+    // Generations since the best weight last improved and the best weight at that time
+    int generationsWithoutImprovement = 0;
+    int stagnationBestWeight = INT_MAX;
+    int restartCount = 0;
+
+    // Flag shared with other algorithms running in parallel, set when any of them reaches the minimum error
+    std::atomic<bool> *stopFlag = NULL;
+
+    // Lower bound computed in parallel (NULL if none), used for the gap criterion and alpha-nearness candidates
+    LowerBound *lowerBound = NULL;
 
 public:
-    GeneticAlgorithm(GraphMatrix *graph, AlgorithmParams params);
+    GeneticAlgorithm(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound = NULL);
     ~GeneticAlgorithm();
 
     Path solveTSP();
 
+    // solveTSP in steps, so that several algorithms can share threads (see Portfolio):
+    // start() creates the initial population, step() runs one generation and returns true when the end condition
+    // is met, finish() saves the adaptation trace and returns the best path
+    void start();
+    bool step();
+    Path finish();
+
+    // The profile counts the allocations of one thread at a time: a caller that moves the run to another thread
+    // detaches it after the last step on the old thread and attaches it before the next call on the new one
+    void attachThread();
+    void detachThread();
+
+    // Creates the initial population in parallel, initializationShare of it with the construction heuristic
     void initializePopulation();
 
+    // Creates individuals from index `first` (inclusive) to `last` (exclusive) of the initial population
+    void initializeIndividuals(int first, int last, int constructedCount, unsigned int seed);
+
     bool endConditionIsMet();
 
+    // Fills the mating pool with individuals chosen by the selection method (the population is not modified)
     void createMatingPool();
 
     // Generates the second population generation using crossover method
@@ -51,30 +150,80 @@ public:
     // Mutates the inviduals of the second genertion population
     void executeMutations();
 
-    // Generates 2 children from 2 parents using OX algorithm (Ordered Crossover)
-    void oxCrossover(int *parent1, int *parent2, int *child1, int *child2);
-
-    // Fills missing sections in child (from index2 to end, and from start to index1) with values from parent
-    void fillMissingSection(int *parent, int *child, int index1, int index2);
-
-    // creates a mating pool using the tournament selection algorithm
-    void tournamentSelection();
-
-    // Returns true if the path contains the given value in section between index1 and index2 inclusive
-    bool sectionContains(int value, int *path, int index1, int index2);
-
     // Mutates the individual by inverting it's path section from index1 (inclusive) to index2(inclusive)
     // index1 must be smaller than index2
     void inversionMutation(Individual *individual, int index1, int index2);
 
+    // Mutates the individual by moving a random segment of 1 to 3 vertices to a random place (weight updated in O(1))
+    void orOptMutation(Individual *individual);
+
     // Creates new population by picking best individuals from current and next populations
     void createNewPopulation();
 
+    // Improves the individual with the local search (if enabled) and updates its weight
+    void applyLocalSearch(Individual *individual);
+
+    // Improves eliteCount best individuals of the population (when local search target is elites)
+    void improveElites();
+
+    // Rewards the rates of the previous generation by the improvement of the mean weight per evaluation,
+    // chooses the rates of the next one and records the state of the adaptation
+    void adaptParameters();
+
+    // Preallocates the adaptation trace ring buffer (empty when the trace is not saved)
+    void resetAdaptationTrace();
+
+    double getMeanWeight();
+
+    // Counts the generations without improvement of the best weight
+    void updateStagnation();
+
+    // Returns true after maxItersWithoutImprovment generations without improvement or when diversity is below minDiversity
+    bool isStagnating();
+
+    // Returns the share of distinct path weights in the (sorted) population
+    float getDiversity();
+
+    // Applies the restart strategy selected in params to the stagnating population
+    void restart();
+
+    // Creates individuals from index `keep` to the end of the population again
+    void reinitialize(int keep);
+
+    // Swaps two random adjacent sections of the path (double bridge move)
+    void doubleBridge(Individual *individual);
+
+    int getRestartCount();
+
+    // Returns the weight of the best individual
+    int getBestWeight();
+
     Path getResult();
 
     float getError(int pathWeight);
     float getPrd(int pathWeight);
 
+    unsigned long long getEvaluationCount();
+
+    // Returns the profile of the run so far
+    const PhaseProfile &getProfile();
+
+    // Adds evaluations to evaluationCount and to the current phase of the profile
+    void countEvaluations(unsigned long long count);
+
+    // Opens the hardware counters for the calling thread and attaches them to the profile (if params.perfCounters is set)
+    void openPerfCounters();
+
+    // Records the time, generation, best and mean weight and diversity of the population in the convergence trace
+    void recordTraceSample();
+
+    unsigned long getInitializationTimeNs();
+
+    // Returns the error of the best individual of the initial population
+    float getInitialPrd();
+
+    void setStopFlag(std::atomic<bool> *stopFlag);
+
     // Utils
 
     double randomDouble();
@@ -87,14 +236,11 @@ public:
      */
     void copyPath(int *fromPath, int *toPath);
 
-    /**
-     * @brief Copy elements from fromArray, to toArray
-     * starting from index index1 inclusive to index2 inclusive
-     */
-    void copySection(int *fromArray, int *toArray, int index1, int index2);
-
     void setMinError();
 
+    // Returns the error at which the algorithm stops for a graph with the given number of vertices
+    static float getMinError(int vertexCount);
+
     // Printing functions
 
     void printCurrentPopulation();
@@ -109,7 +255,8 @@ public:
 
     void printArray(int *arr, int size);
 
-    void printBestPrd();
+    // Prints the generation, the elapsed time and the best weight (every params.progressInterval generations)
+    void printProgress();
 
     // Testing functions
 
@@ -121,7 +268,7 @@ public:
 
     /**
      * @brief Returns true when the execution time limit has been reached,
-     * otherwise returns false
+     * otherwise returns false (the clock is read only every few generations, see Deadline)
      */
     bool executionTimeLimit();
 };
@@ -18,6 +18,16 @@ public:
 
     // Weight of the optimal hamiltionian cycle
     int optimum = 0;
+
+    // Weight added to every tour by a transformation of another instance (see SymmetricTransform),
+    // errors are relative to the weights of the original instance
+    int weightOffset = 0;
+    // Number of vertices of the original instance of a transformed graph (0 - not transformed)
+    int originalVertexCount = 0;
+
+    // Coordinates of the vertices (empty when the instance is given only by the matrix)
+    std::vector<double> coordinatesX;
+    std::vector<double> coordinatesY;
     /**
      * @brief Construct a new Graph Matrix object
      *
@@ -25,6 +35,9 @@ public:
      */
     GraphMatrix(int size);
 
+    // Creates a deep copy of the graph (used to place a replica of the matrix on another NUMA node)
+    GraphMatrix(const GraphMatrix &other);
+
     ~GraphMatrix();
 
     void setOptimum(int optimum);
@@ -48,11 +61,20 @@ public:
     // Returns the number of vertices in the graph
     int getVertexCount();
 
-    // Returns all adjacent vertices to the privided vertex
-    std::vector<int> getAdj(int v);
+    // Returns the number of vertices of the original instance (the minimum error depends on it)
+    int getOriginalVertexCount();
+
+    // Stores all adjacent vertices to the privided vertex in adj (its capacity is reused)
+    void getAdj(int v, std::vector<int> &adj);
 
     // Returns weight of an egde from u to v
     int getWeight(int u, int v);
+
+    // Returns true if weight from u to v equals weight from v to u for all pairs of vertices
+    bool isSymmetric();
+
+    // Returns true if coordinates of all vertices are known
+    bool hasCoordinates();
 };
 
 #endif
@@ -0,0 +1,60 @@
+#ifndef HELD_KARP_HPP
+#define HELD_KARP_HPP
+
+#include <vector>
+#include <cstdint>
+
+#include "GraphMatrix.hpp"
+#include "Path.hpp"
+
+// Exact solver for small instances: Held-Karp dynamic programming over subsets of vertices.
+// The tour starts at vertex 0, cost(S, j) is the weight of the shortest path from 0 through all vertices of S ending at j.
+// Subsets are processed by cardinality, so only the costs of two layers are kept in memory. A subset is stored
+// at its combinatorial (colex) rank in its layer and the predecessors are kept as bytes for the whole table.
+class HeldKarp
+{
+private:
+    GraphMatrix *graph;
+    int vertexCount;
+    // Number of vertices other than the start vertex 0 (bit i of a subset is vertex i + 1)
+    int setSize;
+    int threadCount;
+
+    // incomingWeight[to * vertexCount + from] - weight of the edge (from, to), the inner loop reads one row
+    std::vector<int> incomingWeight;
+
+    // binomial[i][k] - number of k-element subsets of i elements
+    std::vector<std::vector<unsigned long long>> binomial;
+
+    // Costs of the previous and the current layer, subset of rank r ending at its p-th vertex is at r * k + p
+    std::vector<int> previousCost;
+    std::vector<int> cost;
+    // Predecessor of the last vertex for every subset and last vertex, layerOffset[k] is the start of layer k
+    std::vector<uint8_t> predecessor;
+    std::vector<unsigned long long> layerOffset;
+
+    unsigned long long rank(uint32_t subset);
+
+    uint32_t unrank(unsigned long long rank, int k);
+
+    // Computes the ranks [first, last) of layer k
+    void solveLayer(int k, unsigned long long first, unsigned long long last);
+
+    std::vector<int> reconstructPath(int last);
+
+public:
+    // Largest instance the solver accepts (the predecessor table takes (n - 1) * 2^(n - 2) bytes)
+    static const int MAX_VERTEX_COUNT = 26;
+
+    /**
+     * @param threadCount Number of threads computing every layer (0 - all hardware threads)
+     */
+    HeldKarp(GraphMatrix *graph, int threadCount = 0);
+
+    // Returns an optimal tour
+    Path solveTSP();
+
+    float getPrd(int pathWeight);
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef INDIVIDUAL_HPP
 #define INDIVIDUAL_HPP
 
+#include <random>
 #include "GraphMatrix.hpp"
 
 class Individual
@@ -12,12 +13,19 @@ public:
     // Array holding vertices of the path
     int *path;
 
+    // False when the path array is a slice of an external arena (which is not freed by the individual)
+    bool ownsPath = true;
+
     GraphMatrix *graph;
 
     Individual();
     ~Individual();
     Individual(int vertexCount, GraphMatrix *graph);
-    void setRandomPath();
+
+    // Creates an individual which stores its path in the provided buffer (of size vertexCount)
+    Individual(int vertexCount, GraphMatrix *graph, int *pathBuffer);
+
+    void setRandomPath(std::mt19937 &rng);
     void printPath();
 
     // Returns the path weigth
@@ -0,0 +1,61 @@
+#ifndef ISLAND_MODEL_HPP
+#define ISLAND_MODEL_HPP
+
+#include <vector>
+
+#include "GraphMatrix.hpp"
+#include "AlgorithmParams.hpp"
+#include "Path.hpp"
+#include "LowerBound.hpp"
+
+// Statistics of the islands placed on a single NUMA node
+struct NodeStatistics
+{
+    int node;
+    int islandCount = 0;
+    unsigned long long evaluations = 0;
+    // Estimated distance matrix read bandwidth of the islands on this node (every evaluation reads vertexCount weights)
+    double matrixBandwidthMBs = 0.0;
+    // Pages allocated on this node by local / remote cpus during the run
+    long long localAllocations = 0;
+    long long remoteAllocations = 0;
+};
+
+// Runs params.threadCount independent genetic algorithms (islands) in parallel and returns the best result
+class IslandModel
+{
+private:
+    GraphMatrix *graph;
+    AlgorithmParams params;
+    // Shared by all islands (may be NULL)
+    LowerBound *lowerBound;
+
+    // Distance matrix copy of each NUMA node (empty when the graph is not replicated)
+    std::vector<GraphMatrix *> replicas;
+
+    std::vector<NodeStatistics> nodeStatistics;
+
+    // Creates a copy of the graph on every node (each copy is made by a thread pinned to that node)
+    void createReplicas();
+
+    void deleteReplicas();
+
+    // Islands allocate their populations in pinned worker threads
+    std::vector<Path> runNumaAware(std::vector<unsigned long long> &evaluations, std::vector<int> &islandNodes);
+
+    // Islands are allocated by the calling thread, workers are not pinned
+    std::vector<Path> runNaive(std::vector<unsigned long long> &evaluations, std::vector<int> &islandNodes);
+
+public:
+    IslandModel(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound = NULL);
+    ~IslandModel();
+
+    Path solveTSP();
+
+    // Per node statistics of the last solveTSP call
+    std::vector<NodeStatistics> getNodeStatistics();
+
+    void printNodeStatistics();
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef ITERATED_LOCAL_SEARCH_HPP
+#define ITERATED_LOCAL_SEARCH_HPP
+
+#include <vector>
+#include <random>
+
+#include "GraphMatrix.hpp"
+#include "AlgorithmParams.hpp"
+#include "CandidateList.hpp"
+#include "LinKernighan.hpp"
+#include "Path.hpp"
+#include "Timer.hpp"
+#include "Deadline.hpp"
+#include "ConvergenceTrace.hpp"
+#include "LowerBound.hpp"
+
+// Solver running Lin-Kernighan local search from a random tour and then repeatedly
+// perturbing the best tour with a segment swap (double bridge) kick and improving it again
+class IteratedLocalSearch
+{
+private:
+    AlgorithmParams params;
+
+    GraphMatrix *graph;
+    int vertexCount;
+
+    CandidateList *candidates;
+    LinKernighan *lk;
+
+    std::mt19937 rng;
+    Timer timer;
+    Deadline deadline;
+
+    // Best tour, copied from the tour of Lin-Kernighan (which always holds it between steps) by start() and finish()
+    std::vector<int> bestPath;
+    int bestWeight;
+
+    unsigned long long kickCount = 0;
+
+    // Time of the kicks (mutation) and of Lin-Kernighan (local search)
+    PhaseProfile profile;
+    PerfCounters perfCounters;
+
+    // Best weight over time (recorded only if params.traceFile is set)
+    ConvergenceTrace convergenceTrace;
+
+    void recordTraceSample();
+
+    // Lower bound computed in parallel (NULL if none), used for the gap criterion and alpha-nearness candidates
+    LowerBound *lowerBound = NULL;
+
+    // Applies a double bridge kick of two random adjacent segments, returns the change of the weight
+    int kick();
+
+    bool endConditionIsMet();
+
+    int calculateWeight(int *path);
+
+public:
+    // Maximum length of the segments swapped by a kick
+    static const int MAX_KICK_SEGMENT = 50;
+
+    IteratedLocalSearch(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound = NULL);
+    ~IteratedLocalSearch();
+
+    Path solveTSP();
+
+    // solveTSP in steps (see GeneticAlgorithm): start() improves a random tour, step() applies one kick and returns
+    // true when the end condition is met, finish() returns the best path
+    void start();
+    bool step();
+    Path finish();
+
+    // Moves the accounting of the profile between threads (see GeneticAlgorithm)
+    void attachThread();
+    void detachThread();
+
+    float getError(int pathWeight);
+    float getPrd(int pathWeight);
+
+    int getBestWeight();
+
+    unsigned long long getKickCount();
+
+    // Average time of one improvement step of the local search [ns]
+    double getAverageStepNs();
+
+    unsigned long long getImprovingMoves();
+};
+
+#endif
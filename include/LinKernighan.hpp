@@ -0,0 +1,104 @@
+#ifndef LIN_KERNIGHAN_HPP
+#define LIN_KERNIGHAN_HPP
+
+#include <vector>
+
+#include "GraphMatrix.hpp"
+#include "CandidateList.hpp"
+#include "Tour.hpp"
+#include "VertexQueue.hpp"
+
+// Lin-Kernighan style local search (symmetric graphs).
+// An improving move is a sequence of up to maxDepth 2-opt moves (t1 stays fixed, every step breaks the edge (t1, t2)
+// and adds the edge (t2, t3) with t3 taken from the candidate list of t2). The search follows the positive gain criterion,
+// tries `breadth` candidates on the first levels (1 on deeper levels) and undoes the sequence if no closing gives a gain.
+// With depth 3 it covers 2-opt, 3-opt sequential moves and Or-opt moves (Or-3opt).
+class LinKernighan
+{
+private:
+    GraphMatrix *graph;
+    CandidateList *candidates;
+    int vertexCount;
+    int maxDepth;
+
+    // Array tour, or two-level doubly-linked list for large instances
+    Tour *tour;
+
+    // Vertices whose don't-look bit is off
+    VertexQueue queue;
+
+    // 2-opt moves of the currently built sequence (t1, t2, t3, t4 of every step)
+    std::vector<int> moveStack;
+
+    // The last kick (segment first..last moved after `after` from between prev and next) and the 2-opt moves
+    // of the improving moves applied since, so that undoKick() does not have to load the whole tour again
+    int kickFirst = -1;
+    int kickLast = -1;
+    int kickAfter = -1;
+    int kickPrev = -1;
+    int kickNext = -1;
+    std::vector<int> journal;
+
+    // Statistics of the improvement steps
+    unsigned long long improvingMoves = 0;
+    unsigned long long improvementTimeNs = 0;
+
+    // Replaces edges (t1, t2), (t3, t4) with (t2, t3), (t4, t1)
+    void make2OptMove(int t1, int t2, int t3, int t4);
+
+    // Undoes the 2-opt moves of the sequence above the given stack size
+    void undoMoves(int stackSize);
+
+    // Extends the sequence from the edge (t1, t2) with accumulated gain,
+    // returns the gain of the found improving move (0 if none)
+    int step(int level, int t1, int t2, int gain);
+
+    // Tries to find and apply an improving move starting at t1, returns its gain (0 if none was found)
+    int improveVertex(int t1);
+
+    // Runs the search until no vertex is active or the budget is used
+    int improveActive(int budget);
+
+public:
+    // Number of candidates tried on the first levels of the move
+    static const int BREADTH[];
+    static const int BREADTH_LEVELS;
+
+    // twoLevelListMinSize - minimum number of vertices for which the two-level list tour is used (0 - never)
+    LinKernighan(GraphMatrix *graph, CandidateList *candidates, int maxDepth, int twoLevelListMinSize);
+    ~LinKernighan();
+
+    /**
+     * @brief Improves the path in place
+     *
+     * @param path Path of vertexCount vertices
+     * @param budget Maximum number of improving moves (0 - until a local optimum is reached)
+     * @return Decrease of the path weight
+     */
+    int optimize(int *path, int budget);
+
+    // Loads the path to the internal tour with all vertices active (to be used with kick and improve)
+    void load(int *path);
+
+    void store(int *path);
+
+    // Moves segment from `first` to `last` after vertex `after` (a double bridge move for adjacent segments),
+    // only the endpoints become active. Returns the change of the tour weight
+    int kick(int first, int last, int after);
+
+    // Improves the loaded tour starting from the active vertices, returns the decrease of the weight
+    int improve();
+
+    // Restores the tour from before the last kick by undoing the improving moves applied since and the kick
+    // (nothing is active afterwards)
+    void undoKick();
+
+    Tour &getTour();
+
+    unsigned long long getImprovingMoves();
+
+    // Average time of one improvement step (found and applied improving move) [ns]
+    double getAverageStepNs();
+};
+
+#endif
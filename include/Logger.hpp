@@ -0,0 +1,99 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <atomic>
+#include <string>
+#include <initializer_list>
+
+enum LogLevel
+{
+    LEVEL_DEBUG,
+    LEVEL_INFO,
+    LEVEL_WARN,
+    LEVEL_ERROR,
+    LEVEL_OFF
+};
+
+// Named number of a structured log record (the key must be a string literal)
+struct LogField
+{
+    const char *key;
+    double value;
+};
+
+// Leveled, structured log. Every thread writes its records to its own ring buffer without locks, a background thread
+// started by start() drains the buffers in the order of the time of the records and writes them as human readable
+// lines or JSON lines. Before start() and after stop() records are written synchronously. Calls through the LOG_*
+// macros below the active level only compare the level and do not evaluate their arguments.
+class Logger
+{
+public:
+    static std::atomic<int> activeLevel;
+
+    static const int MAX_FIELDS = 8;
+    static const int MESSAGE_SIZE = 256;
+    // Records of the ring buffer of a thread. When it is full, debug records are dropped (and counted) and the
+    // others wait for the background thread
+    static const int BUFFER_CAPACITY = 1024;
+    // Time the background thread sleeps when the buffers are empty
+    static const int DRAIN_PERIOD_MS = 10;
+
+    static bool isEnabled(LogLevel level)
+    {
+        return level >= activeLevel.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Starts the background thread, stop() is called at exit
+     *
+     * @param format "human" or "json"
+     * @param filePath File the records are appended to, empty - standard output
+     * @return false if the file could not be opened (the standard output is used)
+     */
+    static bool start(LogLevel level, std::string format, std::string filePath);
+
+    // Writes the remaining records and stops the background thread
+    static void stop();
+
+    // Writes every record logged so far
+    static void flush();
+
+    static void setLevel(LogLevel level);
+
+    /**
+     * @brief Parses a level name: debug, info, warn, error or off
+     *
+     * @return false if the name is unknown
+     */
+    static bool parseLevel(std::string name, LogLevel &level);
+
+    /**
+     * @brief Logs a printf formatted message with fields, use the LOG_* macros instead
+     *
+     * @param component Part of the program the record comes from (a string literal)
+     */
+    static void write(LogLevel level, const char *component, std::initializer_list<LogField> fields, const char *format, ...)
+        __attribute__((format(printf, 4, 5)));
+};
+
+#define LOG_AT(level, component, ...)                                \
+    do                                                               \
+    {                                                                \
+        if (Logger::isEnabled(level))                                \
+            Logger::write(level, component, {}, __VA_ARGS__);        \
+    } while (0)
+
+#define LOG_DEBUG(component, ...) LOG_AT(LEVEL_DEBUG, component, __VA_ARGS__)
+#define LOG_INFO(component, ...) LOG_AT(LEVEL_INFO, component, __VA_ARGS__)
+#define LOG_WARN(component, ...) LOG_AT(LEVEL_WARN, component, __VA_ARGS__)
+#define LOG_ERROR(component, ...) LOG_AT(LEVEL_ERROR, component, __VA_ARGS__)
+
+// Logs a fixed message with fields, e.g. LOG_EVENT(LEVEL_INFO, "ga", "progress", {"generation", generation}, {"prd", prd})
+#define LOG_EVENT(level, component, message, ...)                             \
+    do                                                                        \
+    {                                                                         \
+        if (Logger::isEnabled(level))                                         \
+            Logger::write(level, component, {__VA_ARGS__}, "%s", message);    \
+    } while (0)
+
+#endif
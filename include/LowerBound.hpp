@@ -0,0 +1,94 @@
+#ifndef LOWER_BOUND_HPP
+#define LOWER_BOUND_HPP
+
+#include <vector>
+#include <atomic>
+
+#include "GraphMatrix.hpp"
+#include "CandidateList.hpp"
+#include "AlgorithmParams.hpp"
+
+// Lower bound of the weight of the optimal tour, meant to be computed in a thread running alongside an engine:
+//   symmetric graphs  - Held-Karp bound: minimum 1-trees with vertex penalties improved by subgradient optimization
+//   asymmetric graphs - assignment bound (Hungarian algorithm)
+// The best bound found so far can be read at any time. The penalties of the best 1-tree give alpha-nearness candidates.
+class LowerBound
+{
+private:
+    GraphMatrix *graph;
+    int vertexCount;
+    int maxIterations;
+
+    std::atomic<int> bound;
+    std::atomic<bool> stopRequested;
+    std::atomic<bool> finished;
+
+    // Penalties of the best 1-tree
+    std::vector<double> penalties;
+
+    // Minimum 1-tree: spanning tree of vertices 1..n-1 (parent of every vertex, -1 for the root, vertices in the order
+    // of adding them) and the two shortest edges of vertex 0
+    std::vector<int> parent;
+    std::vector<int> order;
+    std::vector<int> degree;
+    int firstSpecial;
+    int secondSpecial;
+    // Prim's algorithm buffers
+    std::vector<double> key;
+    std::vector<char> inTree;
+
+    // Weight of edge (u, v) with the penalties of its ends
+    double penalizedWeight(const std::vector<double> &pi, int u, int v);
+
+    // Builds the minimum 1-tree for penalties pi, returns its penalized weight
+    double minimumOneTree(const std::vector<double> &pi);
+
+    // Weight of a nearest neighbor tour (upper bound for the subgradient steps)
+    int nearestNeighborWeight();
+
+    void subgradient();
+
+    void assignment();
+
+public:
+    // Lambda below which the subgradient optimization stops
+    static constexpr double MIN_STEP_FACTOR = 1e-4;
+    // Number of iterations without improvement after which the step factor is halved
+    static const int STEP_PERIOD = 30;
+
+    /**
+     * @param maxIterations Maximum number of subgradient iterations
+     */
+    LowerBound(GraphMatrix *graph, int maxIterations);
+
+    // Computes the bound, returns after maxIterations, convergence or stop()
+    void compute();
+
+    // Makes compute() return as soon as possible
+    void stop();
+
+    // Returns the best bound found so far (0 - none yet)
+    int get();
+
+    // Returns true after compute() returned
+    bool isFinished();
+
+    // Returns the percentage gap between the weight and the bound (infinity if there is no bound yet)
+    float getGap(int weight);
+
+    /**
+     * @brief Builds lists of the k vertices of the smallest alpha-nearness (increase of the weight of the minimum
+     * 1-tree forced to contain the edge) for the penalties of the best 1-tree
+     */
+    CandidateList *createAlphaCandidates(int k);
+
+    /**
+     * @brief Creates the candidate lists selected in params: alpha-nearness if params.candidates is "alpha" and the
+     * 1-tree bound of lowerBound is finished, the nearest neighbors otherwise
+     *
+     * @param lowerBound May be NULL
+     */
+    static CandidateList *createCandidateList(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound);
+};
+
+#endif
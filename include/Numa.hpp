@@ -0,0 +1,43 @@
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+#include <vector>
+
+// Minimal NUMA topology helpers based on the Linux sysfs interface (no libnuma dependency).
+// On systems without NUMA information everything is reported as a single node.
+namespace Numa
+{
+    // Allocation counters of a single node (in pages) read from /sys/devices/system/node/nodeX/numastat
+    struct NodeCounters
+    {
+        long long numaHit = 0;
+        long long numaMiss = 0;
+        long long localNode = 0;
+        long long otherNode = 0;
+    };
+
+    // Returns the number of NUMA nodes (at least 1)
+    int getNodeCount();
+
+    // Returns the ids of the cpus belonging to the given node
+    std::vector<int> getNodeCpus(int node);
+
+    /**
+     * @brief Returns a list of cpus for workerCount workers, distributing the workers
+     * round-robin between the nodes
+     *
+     * @param workerNodes Filled with the node of each worker
+     */
+    std::vector<int> assignCpus(int workerCount, std::vector<int> &workerNodes);
+
+    // Returns the node of the cpu the calling thread is currently running on
+    int getCurrentNode();
+
+    // Pins the calling thread to the given cpu. Returns false if pinning is not supported or failed
+    bool pinCurrentThread(int cpu);
+
+    // Reads allocation counters of the given node
+    NodeCounters readNodeCounters(int node);
+}
+
+#endif
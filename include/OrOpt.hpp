@@ -0,0 +1,60 @@
+#ifndef OR_OPT_HPP
+#define OR_OPT_HPP
+
+#include <random>
+
+#include "GraphMatrix.hpp"
+#include "CandidateList.hpp"
+#include "Tour.hpp"
+#include "VertexQueue.hpp"
+
+// Or-opt: moves segments of 1 to 3 vertices to another place in the tour without reversing them.
+// Only three edges change and the orientation of the tour is kept,
+// so the gain of a move is evaluated in O(1) for both symmetric and asymmetric graphs.
+class OrOpt
+{
+private:
+    GraphMatrix *graph;
+    // Nearest vertices by weight of the edge from the vertex
+    CandidateList *outCandidates;
+    // Nearest vertices by weight of the edge to the vertex (the same as outCandidates for symmetric graphs)
+    CandidateList *inCandidates;
+    int vertexCount;
+
+    // Array tour, or two-level doubly-linked list for large instances
+    Tour *tour;
+
+    // Vertices whose don't-look bit is off
+    VertexQueue queue;
+
+    // Tries to find and apply an improving move of a segment starting at s1, returns its gain (0 if none was found)
+    int improveVertex(int s1);
+
+    // Moves the segment s1..s2 between a and b = next(a), marks the endpoints as active
+    void applyMove(int s1, int s2, int a, int b);
+
+public:
+    static const int MAX_SEGMENT_LENGTH = 3;
+
+    // twoLevelListMinSize - minimum number of vertices for which the two-level list tour is used (0 - never)
+    OrOpt(GraphMatrix *graph, CandidateList *outCandidates, CandidateList *inCandidates, int twoLevelListMinSize);
+    ~OrOpt();
+
+    /**
+     * @brief Improves the path in place
+     *
+     * @param path Path of vertexCount vertices
+     * @param budget Maximum number of improving moves (0 - until a local optimum is reached)
+     * @return Decrease of the path weight
+     */
+    int optimize(int *path, int budget);
+
+    /**
+     * @brief Moves a random segment of 1 to 3 vertices of the path to a random place
+     *
+     * @return Change of the path weight (computed in O(1))
+     */
+    static int mutate(GraphMatrix *graph, int *path, int vertexCount, std::mt19937 &rng);
+};
+
+#endif
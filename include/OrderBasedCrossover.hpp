@@ -0,0 +1,20 @@
+#ifndef ORDER_BASED_CROSSOVER_HPP
+#define ORDER_BASED_CROSSOVER_HPP
+
+#include "Crossover.hpp"
+
+// OX2 (order based crossover): vertices at random positions of parent2 are placed in the positions
+// they occupy in parent1, in the order they have in parent2. Other vertices keep their positions from parent1.
+class OrderBasedCrossover : public Crossover
+{
+private:
+    // Vertices chosen from parent2, in the order of parent2
+    std::vector<int> selected;
+
+public:
+    OrderBasedCrossover(GraphMatrix *graph);
+
+    int crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &rng) override;
+};
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef ORDER_CROSSOVER_HPP
+#define ORDER_CROSSOVER_HPP
+
+#include "Crossover.hpp"
+
+// OX1 (order crossover): the child gets a random section of parent1,
+// the remaining vertices are taken in the order of parent2 starting after the section
+class OrderCrossover : public Crossover
+{
+public:
+    OrderCrossover(GraphMatrix *graph);
+
+    int crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &rng) override;
+};
+
+#endif
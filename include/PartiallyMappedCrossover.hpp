@@ -0,0 +1,21 @@
+#ifndef PARTIALLY_MAPPED_CROSSOVER_HPP
+#define PARTIALLY_MAPPED_CROSSOVER_HPP
+
+#include "Crossover.hpp"
+
+// PMX (partially mapped crossover): the child gets a random section of parent1, other positions are taken
+// from parent2. A vertex of parent2 already copied with the section is replaced by following the mapping
+// between the sections of both parents until a vertex outside of the section is found.
+class PartiallyMappedCrossover : public Crossover
+{
+private:
+    // Index of every vertex of the section in parent1
+    std::vector<int> position;
+
+public:
+    PartiallyMappedCrossover(GraphMatrix *graph);
+
+    int crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &rng) override;
+};
+
+#endif
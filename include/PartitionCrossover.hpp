@@ -0,0 +1,48 @@
+#ifndef PARTITION_CROSSOVER_HPP
+#define PARTITION_CROSSOVER_HPP
+
+#include "Crossover.hpp"
+
+// GPX (generalized partition crossover): the edges found in only one of the parents split the vertices into
+// connected components. A component is a partition if both parents connect its entry vertices (ends of the common
+// edges leaving it) in the same pairs, then its paths can be taken from either parent independently of the others.
+// The child is the first parent with every partition taken from the parent with the cheaper paths in it, so it is
+// never worse than the first parent and often better than both. Deterministic, O(n), symmetric instances only.
+class PartitionCrossover : public Crossover
+{
+private:
+    // Neighbors of every vertex in the parents
+    std::vector<int> next1;
+    std::vector<int> prev1;
+    std::vector<int> next2;
+    std::vector<int> prev2;
+
+    // Union-find of the vertices joined by edges of only one parent, component[v] is the root (-1 - all edges common)
+    std::vector<int> root;
+    std::vector<int> component;
+
+    // Other end of the path of the first parent in the component starting at the vertex
+    std::vector<int> partner;
+    // For every root: true if the component is a partition, weights of the paths of both parents in it
+    std::vector<char> feasible;
+    std::vector<int> weight1;
+    std::vector<int> weight2;
+
+    int find(int v);
+
+    void unite(int u, int v);
+
+    // Returns true if the edge (u, v) is an edge of the second parent
+    bool inParent2(int u, int v);
+
+    // Finds the paths of the parent in every component, pairs their ends (first parent) or compares them
+    // with the pairs of the first parent (second parent), sums their weights
+    void scanPaths(const int *parent, bool first);
+
+public:
+    PartitionCrossover(GraphMatrix *graph);
+
+    int crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &rng) override;
+};
+
+#endif
@@ -3,11 +3,20 @@
 
 #include <vector>
 
+#include "PhaseProfile.hpp"
+
 struct Path
 {
     std::vector<int> vertices;
     int weight;
     float prd;
+    // Lower bound of the optimal weight (0 - not computed) and the percentage gap between weight and it
+    int lowerBound = 0;
+    float gap = 0.0;
+    // Number of restarts of the population after stagnation
+    int restartCount = 0;
+    // Time and evaluations of the phases of the engine
+    PhaseProfile profile;
 
     Path() {}
 
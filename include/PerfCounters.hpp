@@ -0,0 +1,62 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Hardware performance counters of the calling thread (user space only) opened with perf_event_open on Linux.
+// The events are opened as one group, so a single read returns all of them. Events the processor or the kernel does not
+// provide are left out and reported as unavailable. When no event can be opened (other systems, no PMU in a virtual
+// machine, perf_event_paranoid above 2) open() returns false and the solver runs without the counters.
+class PerfCounters
+{
+public:
+    enum Event
+    {
+        CYCLES,
+        INSTRUCTIONS,
+        L1D_MISSES,
+        LLC_MISSES,
+        DTLB_MISSES,
+        BRANCH_MISSES,
+        EVENT_COUNT
+    };
+
+private:
+    int leader = -1;
+    std::vector<int> fds;
+    // Position of every event in the values of the group read (-1 - unavailable)
+    int position[EVENT_COUNT];
+    int memberCount = 0;
+    std::vector<uint64_t> buffer;
+    std::string error;
+
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    // Opens and starts the counters for the calling thread, returns false if none of the events is available
+    bool open();
+
+    void close();
+
+    bool isOpen();
+
+    bool isAvailable(Event event);
+
+    /**
+     * @brief Reads the counts since open(), scaled up if the kernel multiplexed the group with other events
+     *
+     * @param values Filled with the counts of the available events
+     * @return false if the counters are not open, could not be read or the kernel never scheduled the group
+     */
+    bool read(unsigned long long values[EVENT_COUNT]);
+
+    // Returns the reason why open() or the last read() failed
+    std::string getError();
+
+    static const char *getName(Event event);
+};
+
+#endif
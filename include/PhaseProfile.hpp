@@ -0,0 +1,133 @@
+#ifndef PHASE_PROFILE_HPP
+#define PHASE_PROFILE_HPP
+
+#include <chrono>
+
+#include "PerfCounters.hpp"
+
+// Phases of a run of an engine (the Lin-Kernighan engine counts its kicks as mutation)
+enum Phase
+{
+    PHASE_INITIALIZATION,
+    PHASE_MUTATION,
+    PHASE_EVALUATION,
+    PHASE_SELECTION,
+    PHASE_CROSSOVER,
+    PHASE_LOCAL_SEARCH,
+    PHASE_SUCCESSION,
+    PHASE_RESTART,
+    PHASE_COUNT
+};
+
+// Time, number of entries and path evaluations of every phase of a run. Phases can be nested, the time of a phase
+// does not include the phases entered inside it (e.g. local search of the children is not part of crossover).
+// Every entry and exit reads the clock once, building with -DNO_PHASE_PROFILING removes them (see PROFILE_PHASE).
+// With attached hardware counters every entry and exit also reads the counters (one system call).
+// Allocations are charged to phases the same way from the thread-local counters of AllocationCounter.
+// Both kinds of counters belong to one thread: a run that continues on another thread has to be detached by
+// the old thread and attached by the new one (the hardware counters count only the thread that opened them).
+struct PhaseProfile
+{
+    unsigned long long timeNs[PHASE_COUNT] = {};
+    unsigned long long calls[PHASE_COUNT] = {};
+    unsigned long long evaluations[PHASE_COUNT] = {};
+    // Heap allocations and bytes requested by the thread running the phases (see AllocationCounter)
+    unsigned long long allocations[PHASE_COUNT] = {};
+    unsigned long long allocatedBytes[PHASE_COUNT] = {};
+    // Hardware events of every phase, -1 - not measured
+    long long events[PHASE_COUNT][PerfCounters::EVENT_COUNT];
+
+    // Generations completed (kicks of the Lin-Kernighan engine), all path evaluations and the time of the run
+    unsigned long long generations = 0;
+    unsigned long long evaluationCount = 0;
+    unsigned long long runTimeNs = 0;
+
+    // Allocations of the whole run (between startMemory() and finishMemory() on the attached threads, also outside the
+    // phases), peak resident
+    // set size of the process during the run and the memory of the allocator at its end (-1 - unknown)
+    unsigned long long allocationCount = 0;
+    unsigned long long allocatedByteCount = 0;
+    long long peakRssKb = -1;
+    long long arenaBytes = -1;
+    long long arenaInUseBytes = -1;
+
+    // Phase the time is charged to (PHASE_COUNT - none) and the time of entering it
+    Phase current = PHASE_COUNT;
+    std::chrono::steady_clock::time_point since;
+
+    // Counters of the thread running the phases (not owned, NULL - none) and their values when entering the current phase
+    PerfCounters *perfCounters = NULL;
+    unsigned long long lastEvents[PerfCounters::EVENT_COUNT] = {};
+    // Allocation counters of the thread when entering the current phase and when it was attached
+    unsigned long long lastAllocations = 0;
+    unsigned long long lastAllocatedBytes = 0;
+    unsigned long long startAllocations = 0;
+    unsigned long long startAllocatedBytes = 0;
+    bool threadAttached = false;
+
+    PhaseProfile();
+
+    static const char *getName(Phase phase);
+
+    // Starts charging the events of the open counters to the phases
+    void attachCounters(PerfCounters *counters);
+
+    // Stops reading the counters (before they are closed or the profile is copied to another thread)
+    void detachCounters();
+
+    // Starts counting the allocations of the run on the calling thread
+    void startMemory();
+
+    // Detaches the thread and reads the memory of the allocator
+    void finishMemory();
+
+    // Continues counting on the calling thread (counters read from now on are relative to its values)
+    void attachThread();
+
+    // Adds the allocations of the run on the calling thread to the totals, until a thread is attached again
+    void detachThread();
+
+    // Prints the events of every phase that has any
+    void printEvents();
+
+    // Enters the phase, returns the phase that was current
+    Phase enter(Phase phase);
+
+    // Returns to the previous phase
+    void leave(Phase previous);
+
+    // Adds evaluations to the current phase
+    void countEvaluations(unsigned long long count);
+
+    // Adds the counters of a run done in parallel (the run time is the longer of the two)
+    void add(const PhaseProfile &other);
+
+    double getEvaluationsPerSecond() const;
+
+private:
+    // Adds the events since the last read to the current phase
+    void chargeEvents();
+
+    // Adds the allocations since entering the current phase to it
+    void chargeAllocations();
+};
+
+// Charges the time from its construction to its destruction to a phase
+class ScopedPhase
+{
+private:
+    PhaseProfile &profile;
+    Phase previous;
+
+public:
+    ScopedPhase(PhaseProfile &profile, Phase phase) : profile(profile), previous(profile.enter(phase)) {}
+    ~ScopedPhase() { profile.leave(previous); }
+};
+
+#ifdef NO_PHASE_PROFILING
+#define PROFILE_PHASE(profile, phase)
+#else
+#define PROFILE_PHASE(profile, phase) ScopedPhase scopedPhase(profile, phase)
+#endif
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef PORTFOLIO_HPP
+#define PORTFOLIO_HPP
+
+#include <string>
+#include <vector>
+
+#include "GraphMatrix.hpp"
+#include "AlgorithmParams.hpp"
+#include "Path.hpp"
+#include "LowerBound.hpp"
+#include "GeneticAlgorithm.hpp"
+#include "IteratedLocalSearch.hpp"
+
+// How one configuration of the portfolio spent its budget
+struct PortfolioRecord
+{
+    int configuration;
+    std::string description;
+    // Number of rounds in which the configuration ran
+    int rounds = 0;
+    // Thread time given to the configuration [ms]
+    unsigned long timeMs = 0;
+    // Generations (GA) or kicks (Lin-Kernighan)
+    unsigned long long steps = 0;
+    int bestWeight = 0;
+    float prd = 0.0;
+    // "eliminated", "finished" (end condition met) or "survivor" (ran until the time limit)
+    std::string status = "survivor";
+    // true for the configuration that found the best path
+    bool winner = false;
+};
+
+// Races several configurations (generational GA, optionally with local search, or iterated Lin-Kernighan)
+// on one instance by successive halving: in every round all remaining configurations run for an equal share
+// of the round's time on up to threadCount threads, then the worse half (by the best weight) is eliminated,
+// so the survivors get more threads and time in the next rounds. The engines are stepped (one generation or kick
+// at a time) and keep their state between rounds. The whole race takes at most timeLimitMs.
+class Portfolio
+{
+private:
+    GraphMatrix *graph;
+    std::vector<AlgorithmParams> configurations;
+    int timeLimitMs;
+    int threadCount;
+    LowerBound *lowerBound;
+
+    // Engine of every configuration (created in its first round, deleted when it stops)
+    std::vector<GeneticAlgorithm *> geneticAlgorithms;
+    std::vector<IteratedLocalSearch *> localSearches;
+    std::vector<Path> results;
+    std::vector<PortfolioRecord> records;
+
+    // Runs the configuration for sliceMs, returns true if its end condition was met
+    bool runSlice(int configuration, unsigned long sliceMs);
+
+    // Stores the result of the configuration and deletes its engine
+    void stopConfiguration(int configuration, std::string status);
+
+public:
+    /**
+     * @param configurations Parameters of every configuration (engine "generational" or "lin_kernighan")
+     * @param timeLimitMs Wall time of the whole race
+     * @param threadCount Number of configurations running at the same time
+     * @param lowerBound May be NULL
+     */
+    Portfolio(GraphMatrix *graph, std::vector<AlgorithmParams> configurations, int timeLimitMs, int threadCount, LowerBound *lowerBound = NULL);
+    ~Portfolio();
+
+    // Returns the best path found by any configuration
+    Path solveTSP();
+
+    // Budget and result of every configuration of the last solveTSP call
+    std::vector<PortfolioRecord> getRecords();
+
+    // Short description of the parameters that differ between configurations
+    static std::string describe(AlgorithmParams params);
+};
+
+#endif
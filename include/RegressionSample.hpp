@@ -0,0 +1,17 @@
+#ifndef REGRESSION_SAMPLE_HPP
+#define REGRESSION_SAMPLE_HPP
+
+#include <string>
+
+// Result of one run of the regression harness
+struct RegressionSample
+{
+    std::string instanceName;
+    unsigned int seed;
+    // Time to reach the target error (the time limit if it was not reached)
+    double timeToTargetMs;
+    // Error of the final path
+    float prd;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef SELECTION_HPP
+#define SELECTION_HPP
+
+#include <string>
+#include <vector>
+#include <random>
+
+#include "Individual.hpp"
+#include "AliasTable.hpp"
+
+// Selection of parents by index, the population array is never modified
+//   tournament - the fittest of tournamentSize randomly drawn individuals
+//   rank       - linear ranking (population has to be sorted from the best to the worst individual,
+//                as left by the succession)
+//   roulette   - fitness proportional selection, fitness = worst weight - weight + 1
+// rank and roulette sample from an alias table in O(1)
+class Selection
+{
+private:
+    enum Method
+    {
+        TOURNAMENT,
+        RANK,
+        ROULETTE
+    };
+
+    Method method = TOURNAMENT;
+    int tournamentSize = 2;
+    // Expected number of copies of the best individual in linear ranking (1.0 - 2.0)
+    float selectionPressure = 1.5;
+
+    AliasTable aliasTable;
+    std::vector<double> weights;
+
+public:
+    Selection();
+    Selection(std::string method, int tournamentSize, float selectionPressure);
+
+    // Prepares the selection for the current population, has to be called once per generation
+    void prepare(Individual **population, int populationCount);
+
+    // Returns the index of the selected individual
+    int select(Individual **population, int populationCount, std::mt19937 &rng);
+
+    // Returns true if the method name is known
+    static bool isValidMethod(std::string method);
+};
+
+#endif
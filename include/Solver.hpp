@@ -0,0 +1,35 @@
+#ifndef SOLVER_HPP
+#define SOLVER_HPP
+
+#include "GraphMatrix.hpp"
+#include "AlgorithmParams.hpp"
+#include "Path.hpp"
+#include "Portfolio.hpp"
+
+namespace Solver
+{
+    /**
+     * @brief Solves the instance with the engine selected in params
+     * (single generational GA, island model for more than one thread, steady-state GA
+     * or iterated Lin-Kernighan for symmetric instances), instances of at most
+     * params.exactMaxSize vertices are solved exactly with Held-Karp
+     *
+     * @param graph Graph for which to solve the TSP
+     * @return The best path found
+     */
+    Path solve(GraphMatrix *graph, AlgorithmParams params);
+
+    /**
+     * @brief Races the configurations on the instance (see Portfolio) within params.maxExecutionTimeMs
+     * on params.threadCount threads, with the lower bound of params
+     *
+     * @param records Output, budget and result of every configuration
+     * @return The best path found by any configuration
+     */
+    Path solvePortfolio(GraphMatrix *graph, AlgorithmParams params, std::vector<AlgorithmParams> configurations, std::vector<PortfolioRecord> &records);
+
+    // Returns true if the engine name is known
+    bool isValidEngine(std::string engine);
+}
+
+#endif
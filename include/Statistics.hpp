@@ -0,0 +1,26 @@
+#ifndef STATISTICS_HPP
+#define STATISTICS_HPP
+
+#include <vector>
+
+namespace Statistics
+{
+    // Returns the q-quantile (0 - 1) with linear interpolation between the closest values
+    double quantile(std::vector<double> values, double q);
+
+    double median(std::vector<double> values);
+
+    // Returns the values inside [Q1 - factor * IQR, Q3 + factor * IQR] (Tukey's fences)
+    std::vector<double> filterOutliers(std::vector<double> values, double factor);
+
+    /**
+     * @brief One-sided Mann-Whitney U test of the hypothesis that the values of sample1 tend to be larger than
+     * the values of sample2 (normal approximation with the tie and continuity corrections)
+     *
+     * @param u Set to the U statistic of sample1
+     * @return p-value (1 if either sample is empty)
+     */
+    double mannWhitneyGreater(std::vector<double> sample1, std::vector<double> sample2, double &u);
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef STEADY_STATE_GA_HPP
+#define STEADY_STATE_GA_HPP
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <climits>
+
+#include "GraphMatrix.hpp"
+#include "AlgorithmParams.hpp"
+#include "Path.hpp"
+#include "Timer.hpp"
+#include "CandidateList.hpp"
+#include "Crossover.hpp"
+#include "LowerBound.hpp"
+
+// Steady-state genetic algorithm without generation barriers.
+// Worker threads continuously select parents from a shared population, create and evaluate children
+// and replace worse individuals in place. Every population slot is guarded by its own spin lock.
+class SteadyStateGA
+{
+private:
+    // Slot of the shared population
+    struct Slot
+    {
+        std::atomic<bool> locked{false};
+        // Weight may be read without the lock (used by tournaments)
+        std::atomic<int> weight{INT_MAX};
+        int *path;
+    };
+
+    // Thread local state of a worker
+    struct Worker
+    {
+        std::mt19937 rng;
+        int *parent1;
+        int *parent2;
+        int *child1;
+        int *child2;
+        // Crossover operator with the worker's own buffers
+        Crossover *crossover = NULL;
+        unsigned long long evaluationCount = 0;
+    };
+
+    AlgorithmParams params;
+
+    GraphMatrix *graph;
+    int vertexCount;
+
+    Slot *population;
+    int *pathArena;
+
+    // Nearest neighbors shared by the workers' crossover operators (NULL when not needed)
+    CandidateList *candidates = NULL;
+
+    // Best path found so far
+    std::mutex bestMutex;
+    std::atomic<int> bestWeight{INT_MAX};
+    std::vector<int> bestPath;
+
+    // Seed of the initial population, workers use consecutive seeds
+    unsigned int baseSeed;
+
+    std::atomic<bool> stop{false};
+
+    // Lower bound computed in parallel (NULL if none), used for the gap criterion and alpha-nearness candidates
+    LowerBound *lowerBound = NULL;
+    std::atomic<unsigned long long> evaluationCount{0};
+
+    Timer timer;
+
+    void initializePopulation();
+
+    void runWorker(int workerIndex, int cpu);
+
+    // Returns the index of the fittest of tournamentSize randomly chosen slots
+    int tournament(Worker &worker, int tournamentSize);
+
+    // Returns the index of the least fit of tournamentSize randomly chosen slots
+    int inverseTournament(Worker &worker, int tournamentSize);
+
+    // Copies the path and the weight of the slot, returns false if the slot is currently being replaced
+    bool tryReadSlot(int slotIndex, int *buffer, int &weight);
+
+    // Replaces the slot with the child if the child is still better than the slot, returns true on success
+    bool tryReplaceSlot(int slotIndex, int *child, int childWeight);
+
+    // Updates the best path if the given path is better
+    void offerBest(int *path, int weight);
+
+    bool endConditionIsMet();
+
+    void inversionMutation(Worker &worker, int *path);
+
+    int evaluate(int *path);
+
+    // Random int from min (inclusive) to max (inclusive)
+    int randomInt(Worker &worker, int min, int max);
+
+    double randomDouble(Worker &worker);
+
+public:
+    SteadyStateGA(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound = NULL);
+    ~SteadyStateGA();
+
+    Path solveTSP();
+
+    unsigned long long getEvaluationCount();
+
+    float getError(int pathWeight);
+    float getPrd(int pathWeight);
+
+    void setMinError();
+};
+
+#endif
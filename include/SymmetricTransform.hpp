@@ -0,0 +1,46 @@
+#ifndef SYMMETRIC_TRANSFORM_HPP
+#define SYMMETRIC_TRANSFORM_HPP
+
+#include "GraphMatrix.hpp"
+#include "Path.hpp"
+
+// Jonker-Volgenant transformation of an asymmetric instance of n vertices into a symmetric instance of 2n vertices,
+// so that the engines for symmetric instances (2-opt, Lin-Kernighan, EAX, 1-tree bound) can solve it.
+// Vertex i keeps the incoming edges of i and its twin n + i the outgoing ones:
+//   (i, n + i)     - 0, every good tour goes through all of these edges,
+//   (n + i, j)     - w(i, j) + M,
+//   (i, j), (n + i, n + j) - 2M (never used by a good tour).
+// M is larger than the weight of the optimal tour, so every tour of weight below (n + 1)M alternates between
+// vertices and their twins and weighs n * M plus the weight of the original tour.
+class SymmetricTransform
+{
+private:
+    GraphMatrix *graph;
+    GraphMatrix *symmetricGraph;
+    int vertexCount;
+    int penalty;
+
+    int getOriginalWeight(const std::vector<int> &path);
+
+public:
+    SymmetricTransform(GraphMatrix *graph);
+
+    ~SymmetricTransform();
+
+    // Returns false if the weights of the symmetric instance would not fit in an int
+    bool isValid();
+
+    // Returns the symmetric instance (weightOffset is n * M, the optimum is moved by it)
+    GraphMatrix *getSymmetricGraph();
+
+    /**
+     * @brief Maps a tour of the symmetric instance back to a tour of the original instance: the original vertices in
+     * the order of the tour, in the direction of the lower original weight (any tour gives a valid permutation)
+     *
+     * @param path Result of an engine on the symmetric instance
+     * @return Path with the weight, error, lower bound and gap of the original instance
+     */
+    Path mapBack(Path path);
+};
+
+#endif
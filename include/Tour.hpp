@@ -0,0 +1,40 @@
+#ifndef TOUR_HPP
+#define TOUR_HPP
+
+// Tour representation used by the local search algorithms
+class Tour
+{
+public:
+    virtual ~Tour() {}
+
+    // Loads the tour from a path of vertexCount vertices
+    virtual void load(const int *path) = 0;
+
+    // Writes the tour into path
+    virtual void store(int *path) = 0;
+
+    virtual int next(int v) = 0;
+    virtual int prev(int v) = 0;
+
+    // Returns true if b lies on the tour walking forward from a to c (a, b and c inclusive)
+    virtual bool between(int a, int b, int c) = 0;
+
+    // Reverses the part of the tour walking forward from vertex `from` to vertex `to`
+    // (an implementation may reverse the rest of the tour instead, which gives the same cycle in the opposite direction)
+    virtual void reverse(int from, int to) = 0;
+
+    // Moves the segment walking forward from `first` to `last` between vertex `after` and its successor,
+    // keeping the orientation of the segment and of the rest of the tour (`after` must not be in the segment)
+    virtual void moveSegment(int first, int last, int after) = 0;
+
+    virtual int getVertexCount() = 0;
+
+    /**
+     * @brief Creates an array tour, or a two-level doubly-linked list for large instances
+     *
+     * @param twoLevelListMinSize Minimum number of vertices for which the two-level list is used (0 - never)
+     */
+    static Tour *create(int vertexCount, int twoLevelListMinSize);
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef TWO_LEVEL_LIST_HPP
+#define TWO_LEVEL_LIST_HPP
+
+#include <vector>
+#include "Tour.hpp"
+
+// Tour stored as a two-level doubly-linked list: vertices are linked inside segments of about sqrt(n) vertices
+// and the segments form a cyclic doubly-linked list. Every segment has a reversal bit, so a reversal of a path
+// of whole segments only flips the bits and relinks O(sqrt(n)) segments.
+// next / prev / between are O(1), reverse and moveSegment are O(sqrt(n)) (amortized, the structure is rebuilt
+// in O(n) after O(sqrt(n)) reversals, when splitting has produced too many segments).
+class TwoLevelList : public Tour
+{
+private:
+    int vertexCount = 0;
+    int groupSize = 0;
+    int segmentCapacity = 0;
+    int segmentCount = 0;
+
+    // Vertex level: segment, rank inside the segment (increasing along succ) and links in the segment's base direction
+    std::vector<int> nodeSegment;
+    std::vector<int> nodeRank;
+    std::vector<int> succ;
+    std::vector<int> pred;
+
+    // Segment level: first and last vertex in the base direction, reversal bit,
+    // links in the tour direction and rank of the segment in the tour
+    std::vector<int> segmentFirst;
+    std::vector<int> segmentLast;
+    std::vector<char> segmentReversed;
+    std::vector<int> segmentNext;
+    std::vector<int> segmentPrev;
+    std::vector<int> segmentRank;
+    std::vector<int> freeSegments;
+    int headSegment = 0;
+
+    // Buffers reused by the operations
+    std::vector<int> scratch;
+    std::vector<int> rebuildBuffer;
+
+    // First / last vertex of the segment in the tour direction
+    int head(int s);
+    int tail(int s);
+
+    // Position of the vertex in the tour (comparable between vertices)
+    long long key(int v);
+
+    int allocateSegment();
+
+    // Numbers the segments along the tour
+    void renumberSegments();
+
+    // Splits the segment of v so that v is the first vertex of its segment in the tour direction
+    void splitBefore(int v);
+
+    // Reverses the path from..to lying inside one segment
+    void reverseInside(int s, int from, int to);
+
+    // Reverses the path made of whole segments from segment `first` to segment `last`
+    void reverseSegments(int first, int last);
+
+    // Rebuilds the segments of (almost) equal size from the current tour
+    void rebuild();
+
+public:
+    TwoLevelList();
+    TwoLevelList(int vertexCount);
+
+    void load(const int *path) override;
+    void store(int *path) override;
+
+    int next(int v) override;
+    int prev(int v) override;
+
+    bool between(int a, int b, int c) override;
+
+    // Reverses exactly the path from..to (the orientation of the rest of the tour is kept)
+    void reverse(int from, int to) override;
+
+    // Done with three reversals
+    void moveSegment(int first, int last, int after) override;
+
+    int getVertexCount() override;
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef TWO_OPT_HPP
+#define TWO_OPT_HPP
+
+#include "GraphMatrix.hpp"
+#include "CandidateList.hpp"
+#include "Tour.hpp"
+#include "VertexQueue.hpp"
+
+// 2-opt local search with neighbor (candidate) lists and don't-look bits.
+// Gain of every move is evaluated in O(1), which is only valid for symmetric graphs.
+class TwoOpt
+{
+private:
+    GraphMatrix *graph;
+    CandidateList *candidates;
+    int vertexCount;
+
+    // Array tour, or two-level doubly-linked list for large instances
+    Tour *tour;
+
+    // Vertices whose don't-look bit is off
+    VertexQueue queue;
+
+    // Tries to find and apply an improving move starting at t1, returns its gain (0 if none was found)
+    int improveVertex(int t1);
+
+public:
+    // twoLevelListMinSize - minimum number of vertices for which the two-level list tour is used (0 - never)
+    TwoOpt(GraphMatrix *graph, CandidateList *candidates, int twoLevelListMinSize);
+    ~TwoOpt();
+
+    /**
+     * @brief Improves the path in place
+     *
+     * @param path Path of vertexCount vertices
+     * @param budget Maximum number of improving moves (0 - until a local optimum is reached)
+     * @return Decrease of the path weight
+     */
+    int optimize(int *path, int budget);
+};
+
+#endif
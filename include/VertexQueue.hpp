@@ -0,0 +1,32 @@
+#ifndef VERTEX_QUEUE_HPP
+#define VERTEX_QUEUE_HPP
+
+#include <vector>
+
+// FIFO queue of vertices used for don't-look bits in local search
+// (a vertex is in the queue exactly when its don't-look bit is off)
+class VertexQueue
+{
+private:
+    int capacity = 0;
+    std::vector<int> queue;
+    std::vector<char> inQueue;
+    int head = 0;
+    int size = 0;
+
+public:
+    VertexQueue();
+    VertexQueue(int vertexCount);
+
+    // Removes all vertices
+    void clear();
+
+    // Adds the vertex if it is not in the queue yet
+    void push(int v);
+
+    int pop();
+
+    bool isEmpty();
+};
+
+#endif
@@ -9,6 +9,10 @@ namespace graphGenerator
     // Generates and returns a complete, directed, weighted graph
     GraphMatrix *getRandom(int verticesNum, int maxWeight);
 
+    // Generates a complete, symmetric graph of random points in a maxCoordinate x maxCoordinate square,
+    // weights are rounded Euclidean distances (the coordinates are stored in the graph)
+    GraphMatrix *getRandomEuclidean(int verticesNum, int maxCoordinate);
+
     // Returns random int from min (inclusive) to max (inclusive)
     int getRandomInt(int min, int max);
 }
@@ -8,6 +8,38 @@ int main(void);
 // Tests on instances from files
 void fileInstanceTest(std::string inputDir, std::string outputDir);
 
+// Compares naive and NUMA-aware placement of the island model on instances from files
+void numaBenchmark(std::string inputDir, std::string outputDir);
+
+// Compares the Lin-Kernighan solver with optimal tours from .opt.tour files
+void optTourCheck(std::string inputDir, std::string outputDir);
+
+// Compares time to target of the GA with every crossover operator
+void crossoverBenchmark(std::string inputDir, std::string outputDir);
+
+// Compares the speed of crossover operators and the quality of their children
+void crossoverThroughput(std::string inputDir, std::string outputDir);
+
+// Compares time to target of the GA with random initialization and construction heuristics
+void initializationBenchmark(std::string inputDir, std::string outputDir);
+
+// Compares solving asymmetric instances directly and as their symmetric transformation
+void atspTransformBenchmark(std::string inputDir, std::string outputDir);
+
+// Races the configurations of [portfolio] on instances from files
+void portfolio(std::string inputDir, std::string outputDir);
+
+// Compares time to target and final error on instances from files with the saved baseline,
+// returns false on a significant slowdown or loss of quality
+bool regression(std::string inputDir, std::string outputDir);
+
+// Checks that the generations of the GA do not allocate after a warm-up on instances from files,
+// returns false if any of them does
+bool allocationCheck(std::string inputDir, std::string outputDir);
+
+// Returns params with the values given in the section of a portfolio configuration
+AlgorithmParams getPortfolioConfiguration(AlgorithmParams params, std::string tag);
+
 // Tests on random instances
 void randomInstanceTest(std::string outputDir);
 
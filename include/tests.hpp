@@ -1,6 +1,8 @@
 #include "GraphMatrix.hpp"
 #include <string>
+#include <vector>
 #include "AlgorithmParams.hpp"
+#include "RegressionSample.hpp"
 
 #ifndef TESTS_H
 #define TESTS_H
@@ -27,8 +29,117 @@ namespace Tests
      * @param iterCount Number of test repetitions
      * @param instanceName Name of the tested instance
      * @param outputPath Path of the results file for single instance test
+     * @param tracePrefix Convergence traces are saved to <tracePrefix>_<instance>_<run>.csv (empty - not recorded)
+     * @param tttTargets Error targets [%] of the time-to-target distribution saved to <tracePrefix>_<instance>_ttt.csv
      **/
-    void fileInstanceTest(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params);
+    void fileInstanceTest(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params,
+                          std::string tracePrefix = "", std::vector<float> tttTargets = {});
+
+    /**
+     * @brief Computes the empirical distribution of the time to reach every target error from the convergence traces
+     * of several runs, saves the runs that reached the target sorted by the time with their probability
+     *
+     * @param traceFiles Convergence trace files of the runs
+     * @param targets Target errors [%] relative to the optimum of the graph
+     * @param outputPath Path of the time-to-target file
+     **/
+    void timeToTarget(GraphMatrix *graph, std::vector<std::string> traceFiles, std::vector<float> targets, std::string outputPath);
+
+    /**
+     * @brief Runs the algorithm with seeds 1..seedCount and measures the time to reach the target error
+     * (from the convergence trace) and the final error of every run
+     *
+     * @param traceFile Temporary file for the convergence traces (removed afterwards)
+     **/
+    std::vector<RegressionSample> regressionRuns(GraphMatrix *graph, std::string instanceName, int seedCount, float targetPrd,
+                                                 std::string traceFile, AlgorithmParams params);
+
+    /**
+     * @brief Compares the time to target and the final error of the runs of an instance with its baseline runs
+     * (outliers removed by Tukey's fences), saves the comparison to file
+     *
+     * @param alpha Significance level of the one-sided Mann-Whitney U test
+     * @param iqrFactor Factor of the interquartile range of the outlier fences
+     * @return false if either metric is significantly worse than in the baseline or the instance is not in the baseline
+     **/
+    bool compareWithBaseline(std::string instanceName, std::vector<RegressionSample> samples, std::vector<RegressionSample> baseline,
+                             double alpha, double iqrFactor, std::string outputPath);
+
+    /**
+     * @brief Runs warmupGenerations generations of the generational GA, then counts the heap allocations of the next
+     * generationCount generations (in total and per phase), saves the counts to file. Both stop early when the end
+     * condition is met.
+     *
+     * @return true if the checked generations did not allocate
+     **/
+    bool allocationCheck(GraphMatrix *graph, std::string instanceName, int warmupGenerations, int generationCount, std::string outputPath,
+                         AlgorithmParams params);
+
+    /**
+     * @brief Compares naive and NUMA-aware placement of the island model, saves per node results to file
+     *
+     * @param graph Graph for which to run the benchmark
+     * @param iterCount Number of repetitions of each placement
+     * @param instanceName Name of the tested instance
+     * @param outputPath Path of the results file
+     **/
+    void numaBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params);
+
+    /**
+     * @brief Runs the iterated Lin-Kernighan solver and compares its result with the optimal tour, saves results to file
+     *
+     * @param graph Graph of the instance
+     * @param optTour Optimal tour of the instance (0-based vertices)
+     * @param iterCount Number of test repetitions
+     * @param instanceName Name of the tested instance
+     * @param outputPath Path of the results file
+     **/
+    void optTourCheck(GraphMatrix *graph, std::vector<int> optTour, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params);
+
+    /**
+     * @brief Runs the generational GA with every crossover operator until the minimum error or the time limit
+     * is reached, saves the time to target of every run to file
+     *
+     * @param graph Graph of a symmetric instance
+     * @param iterCount Number of runs of each crossover
+     * @param instanceName Name of the tested instance
+     * @param outputPath Path of the results file
+     **/
+    void crossoverBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params);
+
+    /**
+     * @brief Creates children from pairs of 2-opt (Or-opt for asymmetric instances) local optima with every
+     * crossover operator, saves the number of children per second and the quality of children to file
+     *
+     * @param graph Graph of the instance
+     * @param childCount Number of children created by each operator
+     * @param instanceName Name of the tested instance
+     * @param outputPath Path of the results file
+     **/
+    void crossoverThroughput(GraphMatrix *graph, int childCount, std::string instanceName, std::string outputPath, AlgorithmParams params);
+
+    /**
+     * @brief Runs the generational GA with random initialization and with every construction heuristic
+     * until the minimum error or the time limit is reached, saves the time to target of every run to file
+     *
+     * @param graph Graph of the instance
+     * @param iterCount Number of runs of each initialization method
+     * @param instanceName Name of the tested instance
+     * @param outputPath Path of the results file
+     **/
+    void initializationBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params);
+
+    /**
+     * @brief Solves an asymmetric instance with the generational GA and its symmetric transformation with the
+     * generational GA (eax crossover) and the lin_kernighan engine until the minimum error or the time limit
+     * is reached, saves the results of every run to file
+     *
+     * @param graph Graph of an asymmetric instance
+     * @param iterCount Number of runs of each combination
+     * @param instanceName Name of the tested instance
+     * @param outputPath Path of the results file
+     **/
+    void atspTransformBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params);
 
     AlgorithmParams getAlgorithmParams();
 
@@ -0,0 +1,49 @@
+#include "AdaptivePursuit.hpp"
+
+#include <algorithm>
+
+AdaptivePursuit::AdaptivePursuit(int armCount, double minShare, double alpha, double beta)
+{
+    this->armCount = armCount;
+    this->minProbability = minShare / armCount;
+    this->maxProbability = 1.0 - (armCount - 1) * minProbability;
+    this->alpha = alpha;
+    this->beta = beta;
+
+    probabilities.assign(armCount, 1.0 / armCount);
+    estimates.assign(armCount, 0.0);
+}
+
+int AdaptivePursuit::select(std::mt19937 &rng)
+{
+    double r = (double)rng() / rng.max();
+    for (int arm = 0; arm < armCount - 1; ++arm)
+    {
+        r -= probabilities[arm];
+        if (r < 0)
+            return arm;
+    }
+    return armCount - 1;
+}
+
+void AdaptivePursuit::update(int arm, double reward)
+{
+    estimates[arm] += alpha * (reward - estimates[arm]);
+
+    const int best = std::max_element(estimates.begin(), estimates.end()) - estimates.begin();
+    for (int i = 0; i < armCount; ++i)
+    {
+        const double target = i == best ? maxProbability : minProbability;
+        probabilities[i] += beta * (target - probabilities[i]);
+    }
+}
+
+int AdaptivePursuit::getArmCount()
+{
+    return armCount;
+}
+
+const std::vector<double> &AdaptivePursuit::getProbabilities()
+{
+    return probabilities;
+}
@@ -0,0 +1,68 @@
+#include "AliasTable.hpp"
+
+#include <numeric>
+
+void AliasTable::build(const std::vector<double> &weights)
+{
+    const int n = weights.size();
+    probability.resize(n);
+    alias.resize(n);
+    scaled.resize(n);
+    small.clear();
+    large.clear();
+    // The work lists are not reallocated by later builds of the same size
+    small.reserve(n);
+    large.reserve(n);
+
+    const double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+
+    for (int i = 0; i < n; ++i)
+    {
+        scaled[i] = sum > 0 ? weights[i] * n / sum : 1.0;
+        if (scaled[i] < 1.0)
+            small.push_back(i);
+        else
+            large.push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        const int less = small.back();
+        small.pop_back();
+        const int more = large.back();
+        large.pop_back();
+
+        probability[less] = scaled[less];
+        alias[less] = more;
+
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+        if (scaled[more] < 1.0)
+            small.push_back(more);
+        else
+            large.push_back(more);
+    }
+
+    // Remaining entries have probability 1 (up to rounding errors)
+    for (int i : large)
+    {
+        probability[i] = 1.0;
+        alias[i] = i;
+    }
+    for (int i : small)
+    {
+        probability[i] = 1.0;
+        alias[i] = i;
+    }
+}
+
+int AliasTable::sample(std::mt19937 &rng)
+{
+    const int column = rng() % probability.size();
+    const double coin = (double)rng() / rng.max();
+    return coin < probability[column] ? column : alias[column];
+}
+
+int AliasTable::size()
+{
+    return probability.size();
+}
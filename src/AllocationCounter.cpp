@@ -0,0 +1,201 @@
+#include "AllocationCounter.hpp"
+
+#include <new>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#ifdef __linux__
+#include <malloc.h>
+#include <sys/resource.h>
+#endif
+
+// Zero-initialized, so they can be used by allocations made before main()
+static thread_local unsigned long long allocationCount = 0;
+static thread_local unsigned long long allocatedBytes = 0;
+
+static void *allocate(std::size_t size)
+{
+    allocationCount++;
+    allocatedBytes += size;
+
+    if (size == 0)
+        size = 1;
+    void *pointer;
+    while ((pointer = malloc(size)) == NULL)
+    {
+        std::new_handler handler = std::get_new_handler();
+        if (handler == NULL)
+            throw std::bad_alloc();
+        handler();
+    }
+    return pointer;
+}
+
+static void *allocateAligned(std::size_t size, std::align_val_t alignment)
+{
+    allocationCount++;
+    allocatedBytes += size;
+
+    const std::size_t align = std::max((std::size_t)alignment, sizeof(void *));
+    void *pointer;
+    while (posix_memalign(&pointer, align, size == 0 ? 1 : size) != 0)
+    {
+        std::new_handler handler = std::get_new_handler();
+        if (handler == NULL)
+            throw std::bad_alloc();
+        handler();
+    }
+    return pointer;
+}
+
+void *operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return NULL;
+    }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept
+{
+    free(pointer);
+}
+
+unsigned long long AllocationCounter::getAllocations()
+{
+    return allocationCount;
+}
+
+unsigned long long AllocationCounter::getAllocatedBytes()
+{
+    return allocatedBytes;
+}
+
+bool AllocationCounter::resetPeakRss()
+{
+#ifdef __linux__
+    FILE *file = fopen("/proc/self/clear_refs", "w");
+    if (file == NULL)
+        return false;
+    const bool written = fputs("5", file) >= 0;
+    return fclose(file) == 0 && written;
+#else
+    return false;
+#endif
+}
+
+long long AllocationCounter::getPeakRssKb()
+{
+#ifdef __linux__
+    // VmHWM follows resetPeakRss(), the maximum of getrusage() does not
+    FILE *file = fopen("/proc/self/status", "r");
+    if (file != NULL)
+    {
+        char line[256];
+        long long peakKb = -1;
+        while (fgets(line, sizeof(line), file) != NULL)
+        {
+            if (strncmp(line, "VmHWM:", 6) == 0)
+            {
+                peakKb = atoll(line + 6);
+                break;
+            }
+        }
+        fclose(file);
+        if (peakKb >= 0)
+            return peakKb;
+    }
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        return usage.ru_maxrss;
+#endif
+    return -1;
+}
+
+void AllocationCounter::getArenaUsage(long long &arenaBytes, long long &inUseBytes)
+{
+    arenaBytes = -1;
+    inUseBytes = -1;
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const struct mallinfo2 info = mallinfo2();
+    arenaBytes = info.arena;
+    inUseBytes = info.uordblks + info.hblkhd;
+#endif
+}
@@ -0,0 +1,155 @@
+#include "ArrayTour.hpp"
+
+#include <algorithm>
+
+ArrayTour::ArrayTour()
+{
+}
+
+ArrayTour::ArrayTour(int vertexCount)
+{
+    this->vertexCount = vertexCount;
+    this->order.resize(vertexCount);
+    this->position.resize(vertexCount);
+}
+
+void ArrayTour::load(const int *path)
+{
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        order[i] = path[i];
+        position[path[i]] = i;
+    }
+}
+
+void ArrayTour::store(int *path)
+{
+    std::copy(order.begin(), order.end(), path);
+}
+
+int ArrayTour::next(int v)
+{
+    const int i = position[v] + 1;
+    return order[i == vertexCount ? 0 : i];
+}
+
+int ArrayTour::prev(int v)
+{
+    const int i = position[v];
+    return order[i == 0 ? vertexCount - 1 : i - 1];
+}
+
+bool ArrayTour::between(int a, int b, int c)
+{
+    const int pa = position[a];
+    const int pb = position[b];
+    const int pc = position[c];
+
+    if (pa <= pc)
+        return pa <= pb && pb <= pc;
+    return pb >= pa || pb <= pc;
+}
+
+void ArrayTour::reverse(int from, int to)
+{
+    int i = position[from];
+    int j = position[to];
+
+    int length = j - i;
+    if (length < 0)
+        length += vertexCount;
+    length++;
+
+    // Reversing the complementary part gives the same cycle (in the opposite direction)
+    if (2 * length > vertexCount)
+    {
+        const int newI = j + 1 == vertexCount ? 0 : j + 1;
+        const int newJ = i == 0 ? vertexCount - 1 : i - 1;
+        i = newI;
+        j = newJ;
+        length = vertexCount - length;
+    }
+
+    for (int step = 0; step < length / 2; ++step)
+    {
+        const int u = order[i];
+        const int v = order[j];
+        order[i] = v;
+        position[v] = i;
+        order[j] = u;
+        position[u] = j;
+
+        i = i + 1 == vertexCount ? 0 : i + 1;
+        j = j == 0 ? vertexCount - 1 : j - 1;
+    }
+}
+
+void ArrayTour::moveSegment(int first, int last, int after)
+{
+    const int start = position[first];
+    int length = position[last] - start;
+    if (length < 0)
+        length += vertexCount;
+    length++;
+
+    // Number of vertices walking forward from the segment end to `after` (inclusive)
+    int forwardGap = position[after] - position[last];
+    if (forwardGap < 0)
+        forwardGap += vertexCount;
+    const int backwardGap = vertexCount - length - forwardGap;
+
+    std::vector<int> &o = order;
+    const int n = vertexCount;
+
+    // Segment vertices have to be saved, the segment is overwritten by the shifted gap
+    int segmentBuffer[16];
+    std::vector<int> largeBuffer;
+    int *segment = segmentBuffer;
+    if (length > 16)
+    {
+        largeBuffer.resize(length);
+        segment = largeBuffer.data();
+    }
+    for (int k = 0; k < length; ++k)
+    {
+        segment[k] = o[(start + k) % n];
+    }
+
+    int segmentStart;
+    if (forwardGap <= backwardGap)
+    {
+        // Shift the vertices after the segment (up to `after`) back by length
+        for (int k = 0; k < forwardGap; ++k)
+        {
+            const int v = o[(start + length + k) % n];
+            const int p = (start + k) % n;
+            o[p] = v;
+            position[v] = p;
+        }
+        segmentStart = (start + forwardGap) % n;
+    }
+    else
+    {
+        // Shift the vertices before the segment (from the successor of `after`) forward by length
+        for (int k = 1; k <= backwardGap; ++k)
+        {
+            const int v = o[(start - k + n) % n];
+            const int p = (start - k + length + n) % n;
+            o[p] = v;
+            position[v] = p;
+        }
+        segmentStart = (start - backwardGap + n) % n;
+    }
+
+    for (int k = 0; k < length; ++k)
+    {
+        const int p = (segmentStart + k) % n;
+        o[p] = segment[k];
+        position[segment[k]] = p;
+    }
+}
+
+int ArrayTour::getVertexCount()
+{
+    return vertexCount;
+}
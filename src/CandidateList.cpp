@@ -0,0 +1,47 @@
+#include "CandidateList.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+CandidateList::CandidateList()
+{
+    this->vertexCount = 0;
+    this->size = 0;
+}
+
+CandidateList::CandidateList(GraphMatrix *graph, int k, bool incoming)
+{
+    this->vertexCount = graph->getVertexCount();
+    this->size = std::max(0, std::min(k, vertexCount - 1));
+    this->neighbors.resize((size_t)vertexCount * size);
+
+    std::vector<int> others(vertexCount);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        std::iota(others.begin(), others.end(), 0);
+        std::swap(others[v], others[vertexCount - 1]);
+
+        std::partial_sort(others.begin(), others.begin() + size, others.end() - 1, [graph, v, incoming](int a, int b)
+                          { return incoming ? graph->getWeight(a, v) < graph->getWeight(b, v)
+                                            : graph->getWeight(v, a) < graph->getWeight(v, b); });
+
+        std::copy(others.begin(), others.begin() + size, neighbors.begin() + (size_t)v * size);
+    }
+}
+
+CandidateList::CandidateList(int vertexCount, int size, std::vector<int> neighbors)
+{
+    this->vertexCount = vertexCount;
+    this->size = size;
+    this->neighbors = neighbors;
+}
+
+int CandidateList::getSize()
+{
+    return size;
+}
+
+const int *CandidateList::get(int v)
+{
+    return neighbors.data() + (size_t)v * size;
+}
@@ -0,0 +1,331 @@
+#include "Construction.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <climits>
+
+Construction::Construction(GraphMatrix *graph, CandidateList *candidates)
+{
+    this->graph = graph;
+    this->candidates = candidates;
+    this->vertexCount = graph->getVertexCount();
+
+    unvisited.resize(vertexCount);
+    unvisitedIndex.resize(vertexCount);
+    link.resize(2 * vertexCount);
+    fragment.resize(vertexCount);
+    curveOrder.resize(vertexCount);
+
+    const int candidateCount = candidates->getSize();
+    candidateEdges.reserve((size_t)vertexCount * candidateCount);
+    for (int u = 0; u < vertexCount; ++u)
+    {
+        for (int j = 0; j < candidateCount; ++j)
+        {
+            const int v = candidates->get(u)[j];
+            if (graph->directed)
+                candidateEdges.push_back({u, v});
+            else
+                candidateEdges.push_back({std::min(u, v), std::max(u, v)});
+        }
+    }
+
+    std::sort(candidateEdges.begin(), candidateEdges.end(), [graph](const std::pair<int, int> &a, const std::pair<int, int> &b)
+              {
+                  const int weightA = graph->getWeight(a.first, a.second);
+                  const int weightB = graph->getWeight(b.first, b.second);
+                  return weightA != weightB ? weightA < weightB : a < b; });
+    // An edge of a symmetric graph is in the candidates of both of its ends
+    candidateEdges.erase(std::unique(candidateEdges.begin(), candidateEdges.end()), candidateEdges.end());
+}
+
+bool Construction::isValidMethod(std::string method)
+{
+    return method == "random" || method == "nearest_neighbor" || method == "greedy" || method == "space_filling_curve";
+}
+
+void Construction::construct(std::string method, int *path, std::mt19937 &rng)
+{
+    if (method == "greedy")
+        greedyEdge(path, rng);
+    else if (method == "space_filling_curve")
+        spaceFillingCurve(path, rng);
+    else
+        nearestNeighbor(path, rng);
+}
+
+void Construction::resetUnvisited()
+{
+    std::iota(unvisited.begin(), unvisited.end(), 0);
+    std::iota(unvisitedIndex.begin(), unvisitedIndex.end(), 0);
+    unvisitedCount = vertexCount;
+}
+
+void Construction::visit(int v)
+{
+    // Swap v with the last unvisited vertex, so its index is not smaller than unvisitedCount
+    const int index = unvisitedIndex[v];
+    const int last = unvisited[--unvisitedCount];
+    unvisited[index] = last;
+    unvisitedIndex[last] = index;
+    unvisited[unvisitedCount] = v;
+    unvisitedIndex[v] = unvisitedCount;
+}
+
+int Construction::nearestUnvisited(int v)
+{
+    const int *near = candidates->get(v);
+    for (int j = 0; j < candidates->getSize(); ++j)
+    {
+        if (unvisitedIndex[near[j]] < unvisitedCount)
+        {
+            return near[j];
+        }
+    }
+
+    int nearest = -1;
+    int nearestWeight = INT_MAX;
+    for (int i = 0; i < unvisitedCount; ++i)
+    {
+        const int weight = graph->getWeight(v, unvisited[i]);
+        if (weight < nearestWeight)
+        {
+            nearest = unvisited[i];
+            nearestWeight = weight;
+        }
+    }
+    return nearest;
+}
+
+void Construction::nearestNeighbor(int *path, std::mt19937 &rng)
+{
+    resetUnvisited();
+
+    int current = rng() % vertexCount;
+    for (int k = 0; k < vertexCount; ++k)
+    {
+        path[k] = current;
+        visit(current);
+        if (unvisitedCount == 0)
+            break;
+
+        int next = -1;
+        if ((double)rng() / rng.max() < NEAREST_NEIGHBOR_RANDOMIZATION)
+        {
+            // Second nearest unvisited vertex among the candidates
+            const int *near = candidates->get(current);
+            int found = 0;
+            for (int j = 0; j < candidates->getSize() && found < 2; ++j)
+            {
+                if (unvisitedIndex[near[j]] < unvisitedCount)
+                {
+                    next = near[j];
+                    found++;
+                }
+            }
+        }
+        current = next >= 0 ? next : nearestUnvisited(current);
+    }
+}
+
+int Construction::findFragment(int v)
+{
+    while (fragment[v] != v)
+    {
+        fragment[v] = fragment[fragment[v]];
+        v = fragment[v];
+    }
+    return v;
+}
+
+void Construction::greedyEdge(int *path, std::mt19937 &rng)
+{
+    std::fill(link.begin(), link.end(), -1);
+    std::iota(fragment.begin(), fragment.end(), 0);
+
+    if (graph->directed)
+        greedyAsymmetric(path, rng);
+    else
+        greedySymmetric(path, rng);
+}
+
+void Construction::greedySymmetric(int *path, std::mt19937 &rng)
+{
+    for (const std::pair<int, int> &edge : candidateEdges)
+    {
+        const int u = edge.first;
+        const int v = edge.second;
+        // Both ends must have a free link (the first link is always used first)
+        if (link[2 * u + 1] >= 0 || link[2 * v + 1] >= 0)
+            continue;
+        if ((double)rng() / rng.max() < GREEDY_RANDOMIZATION)
+            continue;
+
+        const int fragmentU = findFragment(u);
+        const int fragmentV = findFragment(v);
+        if (fragmentU == fragmentV)
+            continue;
+
+        link[link[2 * u] < 0 ? 2 * u : 2 * u + 1] = v;
+        link[link[2 * v] < 0 ? 2 * v : 2 * v + 1] = u;
+        fragment[fragmentU] = fragmentV;
+    }
+
+    // Only the ends of the fragments are left as unvisited, so the fragments are joined by nearest neighbor
+    unvisitedCount = 0;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        unvisitedIndex[v] = vertexCount;
+        if (link[2 * v + 1] < 0)
+        {
+            unvisited[unvisitedCount] = v;
+            unvisitedIndex[v] = unvisitedCount++;
+        }
+    }
+
+    int k = 0;
+    int end = appendFragment(unvisited[rng() % unvisitedCount], path, k);
+    while (k < vertexCount)
+    {
+        end = appendFragment(nearestUnvisited(end), path, k);
+    }
+}
+
+void Construction::greedyAsymmetric(int *path, std::mt19937 &rng)
+{
+    // link[2 * v] is the successor and link[2 * v + 1] the predecessor of v
+    for (const std::pair<int, int> &edge : candidateEdges)
+    {
+        const int u = edge.first;
+        const int v = edge.second;
+        if (link[2 * u] >= 0 || link[2 * v + 1] >= 0)
+            continue;
+        if ((double)rng() / rng.max() < GREEDY_RANDOMIZATION)
+            continue;
+
+        const int fragmentU = findFragment(u);
+        const int fragmentV = findFragment(v);
+        if (fragmentU == fragmentV)
+            continue;
+
+        link[2 * u] = v;
+        link[2 * v + 1] = u;
+        fragment[fragmentU] = fragmentV;
+    }
+
+    // Only the first vertices of the fragments are left as unvisited
+    unvisitedCount = 0;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        unvisitedIndex[v] = vertexCount;
+        if (link[2 * v + 1] < 0)
+        {
+            unvisited[unvisitedCount] = v;
+            unvisitedIndex[v] = unvisitedCount++;
+        }
+    }
+
+    int k = 0;
+    int end = appendFragment(unvisited[rng() % unvisitedCount], path, k);
+    while (k < vertexCount)
+    {
+        end = appendFragment(nearestUnvisited(end), path, k);
+    }
+}
+
+int Construction::appendFragment(int first, int *path, int &k)
+{
+    visit(first);
+
+    int prev = -1;
+    int current = first;
+    int last = first;
+    while (current >= 0)
+    {
+        path[k++] = current;
+        last = current;
+
+        int next;
+        if (graph->directed)
+            next = link[2 * current];
+        else
+            next = link[2 * current] != prev ? link[2 * current] : link[2 * current + 1];
+        prev = current;
+        current = next;
+    }
+
+    // Both ends of an undirected fragment are unvisited
+    if (!graph->directed && last != first)
+    {
+        visit(last);
+    }
+    return last;
+}
+
+void Construction::spaceFillingCurve(int *path, std::mt19937 &rng)
+{
+    if (!graph->hasCoordinates())
+    {
+        nearestNeighbor(path, rng);
+        return;
+    }
+
+    const std::vector<double> &x = graph->coordinatesX;
+    const std::vector<double> &y = graph->coordinatesY;
+    const double minX = *std::min_element(x.begin(), x.end());
+    const double minY = *std::min_element(y.begin(), y.end());
+    const double width = std::max(*std::max_element(x.begin(), x.end()) - minX, *std::max_element(y.begin(), y.end()) - minY);
+
+    // Points are scaled to a half of the grid, then mirrored and shifted at random inside the grid,
+    // so that different tours follow different parts of the curve
+    const unsigned int half = CURVE_GRID_SIZE / 2;
+    const double scale = width > 0 ? (half - 1) / width : 0.0;
+    const bool mirrorX = rng() & 1;
+    const bool mirrorY = rng() & 1;
+    const bool swapAxes = rng() & 1;
+    const unsigned int shiftX = rng() % half;
+    const unsigned int shiftY = rng() % half;
+
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        unsigned int cellX = (unsigned int)((x[v] - minX) * scale);
+        unsigned int cellY = (unsigned int)((y[v] - minY) * scale);
+        if (mirrorX)
+            cellX = half - 1 - cellX;
+        if (mirrorY)
+            cellY = half - 1 - cellY;
+        if (swapAxes)
+            std::swap(cellX, cellY);
+
+        curveOrder[v] = {hilbertIndex(CURVE_GRID_SIZE, cellX + shiftX, cellY + shiftY), v};
+    }
+
+    std::sort(curveOrder.begin(), curveOrder.end());
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        path[i] = curveOrder[i].second;
+    }
+}
+
+unsigned long long Construction::hilbertIndex(unsigned int gridSize, unsigned int x, unsigned int y)
+{
+    unsigned long long index = 0;
+    for (unsigned int s = gridSize / 2; s > 0; s /= 2)
+    {
+        const unsigned int rx = (x & s) > 0;
+        const unsigned int ry = (y & s) > 0;
+        index += (unsigned long long)s * s * ((3 * rx) ^ ry);
+
+        // Rotate the quadrant
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = gridSize - 1 - x;
+                y = gridSize - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
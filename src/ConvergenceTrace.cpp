@@ -0,0 +1,53 @@
+#include "ConvergenceTrace.hpp"
+
+void ConvergenceTrace::reset(int capacity)
+{
+    samples.assign(capacity > 0 ? capacity : 0, TraceSample());
+    next = 0;
+    recordedCount = 0;
+}
+
+void ConvergenceTrace::record(const TraceSample &sample)
+{
+    if (samples.empty())
+    {
+        return;
+    }
+    samples[next] = sample;
+    next = next + 1 == samples.size() ? 0 : next + 1;
+    recordedCount++;
+}
+
+bool ConvergenceTrace::isEnabled()
+{
+    return !samples.empty();
+}
+
+std::vector<TraceSample> ConvergenceTrace::getSamples()
+{
+    if (recordedCount < samples.size())
+    {
+        return std::vector<TraceSample>(samples.begin(), samples.begin() + recordedCount);
+    }
+
+    std::vector<TraceSample> ordered(samples.begin() + next, samples.end());
+    ordered.insert(ordered.end(), samples.begin(), samples.begin() + next);
+    return ordered;
+}
+
+unsigned long long ConvergenceTrace::getDroppedCount()
+{
+    return recordedCount > samples.size() ? recordedCount - samples.size() : 0;
+}
+
+long long ConvergenceTrace::timeToTarget(const std::vector<TraceSample> &samples, int targetWeight)
+{
+    for (const TraceSample &sample : samples)
+    {
+        if (sample.bestWeight <= targetWeight)
+        {
+            return sample.timeNs;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,98 @@
+#include "Crossover.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+
+#include "OrderCrossover.hpp"
+#include "OrderBasedCrossover.hpp"
+#include "PartiallyMappedCrossover.hpp"
+#include "CycleCrossover.hpp"
+#include "EdgeRecombinationCrossover.hpp"
+#include "EdgeAssemblyCrossover.hpp"
+#include "PartitionCrossover.hpp"
+
+Crossover::Crossover(GraphMatrix *graph)
+{
+    this->graph = graph;
+    this->vertexCount = graph->getVertexCount();
+    this->mark.assign(vertexCount, 0);
+}
+
+void Crossover::clearMarks()
+{
+    if (++stamp == 0)
+    {
+        std::fill(mark.begin(), mark.end(), 0);
+        stamp = 1;
+    }
+}
+
+int Crossover::evaluate(const int *path)
+{
+    int sum = 0;
+    for (int i = 0; i < vertexCount - 1; ++i)
+    {
+        sum += graph->getWeight(path[i], path[i + 1]);
+    }
+    return sum + graph->getWeight(path[vertexCount - 1], path[0]);
+}
+
+int Crossover::randomInt(std::mt19937 &rng, int min, int max)
+{
+    return min + rng() % (max - min + 1);
+}
+
+Crossover *Crossover::create(std::string name, GraphMatrix *graph, CandidateList *candidates)
+{
+    if (needsSymmetricGraph(name) && graph->directed)
+    {
+        LOG_WARN("crossover", "%s requires a symmetric instance, using ox1 crossover.", name.c_str());
+    }
+    else if (name == "eax" && candidates != NULL)
+    {
+        return new EdgeAssemblyCrossover(graph, candidates);
+    }
+    else if (name == "ox2")
+    {
+        return new OrderBasedCrossover(graph);
+    }
+    else if (name == "pmx")
+    {
+        return new PartiallyMappedCrossover(graph);
+    }
+    else if (name == "cx")
+    {
+        return new CycleCrossover(graph);
+    }
+    else if (name == "erx")
+    {
+        return new EdgeRecombinationCrossover(graph);
+    }
+    else if (name == "gpx")
+    {
+        return new PartitionCrossover(graph);
+    }
+    return new OrderCrossover(graph);
+}
+
+bool Crossover::needsCandidates(std::string name, GraphMatrix *graph)
+{
+    return name == "eax" && !graph->directed;
+}
+
+bool Crossover::needsSymmetricGraph(std::string name)
+{
+    return name == "eax" || name == "gpx";
+}
+
+const std::vector<std::string> &Crossover::getNames()
+{
+    static const std::vector<std::string> names = {"ox1", "ox2", "pmx", "cx", "erx", "eax", "gpx"};
+    return names;
+}
+
+bool Crossover::isValidName(std::string name)
+{
+    const std::vector<std::string> &names = getNames();
+    return std::find(names.begin(), names.end(), name) != names.end();
+}
@@ -0,0 +1,37 @@
+#include "CycleCrossover.hpp"
+
+CycleCrossover::CycleCrossover(GraphMatrix *graph) : Crossover(graph)
+{
+    position.resize(vertexCount);
+}
+
+int CycleCrossover::crossover(const int *parent1, int /*parent1Weight*/, const int *parent2, int *child, std::mt19937 &rng)
+{
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        position[parent1[i]] = i;
+    }
+
+    // Marks are used for positions already filled
+    clearMarks();
+    bool fromParent1 = rng() & 1;
+    for (int start = 0; start < vertexCount; ++start)
+    {
+        if (mark[start] == stamp)
+        {
+            continue;
+        }
+
+        int i = start;
+        do
+        {
+            child[i] = fromParent1 ? parent1[i] : parent2[i];
+            mark[i] = stamp;
+            i = position[parent2[i]];
+        } while (i != start);
+
+        fromParent1 = !fromParent1;
+    }
+
+    return evaluate(child);
+}
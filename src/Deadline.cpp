@@ -0,0 +1,36 @@
+#include "Deadline.hpp"
+
+const long Deadline::CHECK_PERIOD_NS;
+const int Deadline::MAX_STRIDE;
+
+void Deadline::start(unsigned long limitMs)
+{
+    lastCheck = std::chrono::steady_clock::now();
+    end = lastCheck + std::chrono::milliseconds(limitMs);
+    stride = 1;
+    callsUntilCheck = 1;
+    reached = false;
+}
+
+bool Deadline::isReached()
+{
+    if (reached || --callsUntilCheck > 0)
+    {
+        return reached;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const long sinceLastCheckNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastCheck).count();
+    if (sinceLastCheckNs < CHECK_PERIOD_NS / 2 && stride < MAX_STRIDE)
+    {
+        stride *= 2;
+    }
+    else if (sinceLastCheckNs > CHECK_PERIOD_NS * 2 && stride > 1)
+    {
+        stride /= 2;
+    }
+    callsUntilCheck = stride;
+    lastCheck = now;
+    reached = now >= end;
+    return reached;
+}
@@ -0,0 +1,338 @@
+#include "EdgeAssemblyCrossover.hpp"
+
+#include <algorithm>
+#include <climits>
+
+EdgeAssemblyCrossover::EdgeAssemblyCrossover(GraphMatrix *graph, CandidateList *candidates) : Crossover(graph)
+{
+    this->candidates = candidates;
+
+    linkA.resize(2 * vertexCount);
+    linkB.resize(2 * vertexCount);
+    link.resize(2 * vertexCount);
+    restA.resize(2 * vertexCount);
+    restB.resize(2 * vertexCount);
+    restCountA.resize(vertexCount);
+    evenPosition.assign(vertexCount, -1);
+    oddPosition.assign(vertexCount, -1);
+    subtour.resize(vertexCount);
+
+    walk.reserve(vertexCount + 1);
+    cycleVertices.reserve(2 * vertexCount);
+    subtourVertices.reserve(vertexCount);
+}
+
+int EdgeAssemblyCrossover::crossover(const int *parentA, int parentAWeight, const int *parentB, int *child, std::mt19937 &rng)
+{
+    // Tours of less than 5 vertices have at most one AB-cycle, which turns parent A into parent B
+    if (vertexCount < 5)
+    {
+        std::copy(parentA, parentA + vertexCount, child);
+        return parentAWeight;
+    }
+
+    setLinks(parentA, linkA);
+    setLinks(parentB, linkB);
+    buildCycles(rng);
+
+    // The parents are the same tour
+    if (cycleStart.empty())
+    {
+        std::copy(parentA, parentA + vertexCount, child);
+        return parentAWeight;
+    }
+
+    link = linkA;
+    int weight = parentAWeight + applyCycle(rng() % cycleStart.size());
+
+    for (int subtourCount = findSubtours(); subtourCount > 1; --subtourCount)
+    {
+        weight += mergeSmallestSubtour();
+    }
+
+    int prev = link[1];
+    int current = 0;
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        child[i] = current;
+        const int next = link[2 * current] != prev ? link[2 * current] : link[2 * current + 1];
+        prev = current;
+        current = next;
+    }
+
+    return weight;
+}
+
+void EdgeAssemblyCrossover::setLinks(const int *path, std::vector<int> &linkX)
+{
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        const int v = path[i];
+        linkX[2 * v] = path[(i + vertexCount - 1) % vertexCount];
+        linkX[2 * v + 1] = path[(i + 1) % vertexCount];
+    }
+}
+
+void EdgeAssemblyCrossover::buildCycles(std::mt19937 &rng)
+{
+    cycleVertices.clear();
+    cycleStart.clear();
+
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        restCountA[v] = 0;
+        for (int k = 0; k < 2; ++k)
+        {
+            const int a = linkA[2 * v + k];
+            const int b = linkB[2 * v + k];
+            const bool sharedA = a == linkB[2 * v] || a == linkB[2 * v + 1];
+            const bool sharedB = b == linkA[2 * v] || b == linkA[2 * v + 1];
+            restA[2 * v + k] = sharedA ? -1 : a;
+            restB[2 * v + k] = sharedB ? -1 : b;
+            restCountA[v] += sharedA ? 0 : 1;
+        }
+    }
+
+    // Random walks alternating between the rest edges of A (from even positions of the walk)
+    // and of B (from odd positions). When the walk comes back to a vertex at a position of the same parity,
+    // the closed part is an AB-cycle, it is cut off and the walk continues from that vertex.
+    const int offset = rng() % vertexCount;
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        const int start = (offset + i) % vertexCount;
+        if (restCountA[start] == 0)
+        {
+            continue;
+        }
+
+        walk.clear();
+        walk.push_back(start);
+        evenPosition[start] = 0;
+
+        while (true)
+        {
+            const int last = walk.size() - 1;
+            const int v = walk[last];
+            const bool edgeOfA = last % 2 == 0;
+            std::vector<int> &rest = edgeOfA ? restA : restB;
+
+            const int first = rest[2 * v];
+            const int second = rest[2 * v + 1];
+            // The number of rest edges of A and B is equal in every vertex,
+            // so the walk can only get stuck at the start vertex
+            if (first < 0 && second < 0)
+            {
+                break;
+            }
+            const int u = (first >= 0 && second >= 0) ? ((rng() & 1) ? first : second) : std::max(first, second);
+
+            removeRestEdge(rest, v, u);
+            if (edgeOfA)
+            {
+                restCountA[v]--;
+                restCountA[u]--;
+            }
+
+            std::vector<int> &position = edgeOfA ? oddPosition : evenPosition;
+            if (position[u] < 0)
+            {
+                position[u] = walk.size();
+                walk.push_back(u);
+                continue;
+            }
+
+            // Cycle walk[k] .. walk[last], rotated to start with an edge of A
+            const int k = position[u];
+            cycleStart.push_back(cycleVertices.size());
+            if (k % 2 == 0)
+            {
+                cycleVertices.insert(cycleVertices.end(), walk.begin() + k, walk.end());
+            }
+            else
+            {
+                cycleVertices.insert(cycleVertices.end(), walk.begin() + k + 1, walk.end());
+                cycleVertices.push_back(walk[k]);
+            }
+
+            for (int j = k + 1; j <= last; ++j)
+            {
+                (j % 2 == 0 ? evenPosition : oddPosition)[walk[j]] = -1;
+            }
+            walk.resize(k + 1);
+        }
+
+        for (int j = 0; j < (int)walk.size(); ++j)
+        {
+            (j % 2 == 0 ? evenPosition : oddPosition)[walk[j]] = -1;
+        }
+    }
+}
+
+void EdgeAssemblyCrossover::removeRestEdge(std::vector<int> &rest, int u, int v)
+{
+    rest[rest[2 * u] == v ? 2 * u : 2 * u + 1] = -1;
+    rest[rest[2 * v] == u ? 2 * v : 2 * v + 1] = -1;
+}
+
+void EdgeAssemblyCrossover::replaceLink(int v, int from, int to)
+{
+    link[link[2 * v] == from ? 2 * v : 2 * v + 1] = to;
+}
+
+int EdgeAssemblyCrossover::applyCycle(int cycle)
+{
+    const int begin = cycleStart[cycle];
+    const int end = cycle + 1 < (int)cycleStart.size() ? cycleStart[cycle + 1] : cycleVertices.size();
+    const int length = end - begin;
+    const int *vertices = cycleVertices.data() + begin;
+
+    int delta = 0;
+
+    // Edges of A are at even positions, all of them are removed before adding the edges of B
+    for (int i = 0; i < length; i += 2)
+    {
+        const int a = vertices[i];
+        const int b = vertices[i + 1];
+        replaceLink(a, b, -1);
+        replaceLink(b, a, -1);
+        delta -= graph->getWeight(a, b);
+    }
+    for (int i = 1; i < length; i += 2)
+    {
+        const int a = vertices[i];
+        const int b = vertices[(i + 1) % length];
+        replaceLink(a, -1, b);
+        replaceLink(b, -1, a);
+        delta += graph->getWeight(a, b);
+    }
+
+    return delta;
+}
+
+int EdgeAssemblyCrossover::findSubtours()
+{
+    std::fill(subtour.begin(), subtour.end(), -1);
+    subtourSize.clear();
+    subtourVertex.clear();
+
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        if (subtour[v] >= 0)
+        {
+            continue;
+        }
+
+        const int id = subtourSize.size();
+        int size = 0;
+        int prev = link[2 * v + 1];
+        int current = v;
+        do
+        {
+            subtour[current] = id;
+            size++;
+            const int next = link[2 * current] != prev ? link[2 * current] : link[2 * current + 1];
+            prev = current;
+            current = next;
+        } while (current != v);
+
+        subtourSize.push_back(size);
+        subtourVertex.push_back(v);
+    }
+
+    return subtourSize.size();
+}
+
+int EdgeAssemblyCrossover::mergeSmallestSubtour()
+{
+    int smallest = -1;
+    for (int id = 0; id < (int)subtourSize.size(); ++id)
+    {
+        if (subtourSize[id] > 0 && (smallest < 0 || subtourSize[id] < subtourSize[smallest]))
+        {
+            smallest = id;
+        }
+    }
+
+    subtourVertices.clear();
+    const int start = subtourVertex[smallest];
+    int prev = link[2 * start + 1];
+    int current = start;
+    do
+    {
+        subtourVertices.push_back(current);
+        const int next = link[2 * current] != prev ? link[2 * current] : link[2 * current + 1];
+        prev = current;
+        current = next;
+    } while (current != start);
+
+    // Edge a-b of the subtour and edge w-w2 of another subtour are replaced by a-w and b-w2
+    int bestDelta = INT_MAX;
+    int bestA = -1, bestB = -1, bestW = -1, bestW2 = -1;
+    auto tryExchange = [&](int a, int b, int w)
+    {
+        for (int k = 0; k < 2; ++k)
+        {
+            const int w2 = link[2 * w + k];
+            const int delta = graph->getWeight(a, w) + graph->getWeight(b, w2) - graph->getWeight(a, b) - graph->getWeight(w, w2);
+            if (delta < bestDelta)
+            {
+                bestDelta = delta;
+                bestA = a;
+                bestB = b;
+                bestW = w;
+                bestW2 = w2;
+            }
+        }
+    };
+
+    const int size = subtourVertices.size();
+    const int candidateCount = candidates->getSize();
+    for (int i = 0; i < size; ++i)
+    {
+        const int v = subtourVertices[i];
+        const int v2 = subtourVertices[(i + 1) % size];
+        for (int j = 0; j < candidateCount; ++j)
+        {
+            const int w = candidates->get(v)[j];
+            if (subtour[w] != smallest)
+                tryExchange(v, v2, w);
+
+            const int w2 = candidates->get(v2)[j];
+            if (subtour[w2] != smallest)
+                tryExchange(v2, v, w2);
+        }
+    }
+
+    // All candidates of the subtour lie in the subtour itself
+    if (bestA < 0)
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            const int v = subtourVertices[i];
+            const int v2 = subtourVertices[(i + 1) % size];
+            for (int w = 0; w < vertexCount; ++w)
+            {
+                if (subtour[w] != smallest)
+                {
+                    tryExchange(v, v2, w);
+                    tryExchange(v2, v, w);
+                }
+            }
+        }
+    }
+
+    replaceLink(bestA, bestB, bestW);
+    replaceLink(bestB, bestA, bestW2);
+    replaceLink(bestW, bestW2, bestA);
+    replaceLink(bestW2, bestW, bestB);
+
+    const int target = subtour[bestW];
+    for (int v : subtourVertices)
+    {
+        subtour[v] = target;
+    }
+    subtourSize[target] += size;
+    subtourSize[smallest] = 0;
+
+    return bestDelta;
+}
@@ -0,0 +1,94 @@
+#include "EdgeRecombinationCrossover.hpp"
+
+#include <numeric>
+
+EdgeRecombinationCrossover::EdgeRecombinationCrossover(GraphMatrix *graph) : Crossover(graph)
+{
+    neighbors.resize(MAX_NEIGHBORS * vertexCount);
+    neighborCount.resize(vertexCount);
+    unvisited.resize(vertexCount);
+    unvisitedIndex.resize(vertexCount);
+}
+
+void EdgeRecombinationCrossover::addNeighbor(int v, int u)
+{
+    int *list = neighbors.data() + MAX_NEIGHBORS * v;
+    for (int i = 0; i < neighborCount[v]; ++i)
+    {
+        if (list[i] == u)
+            return;
+    }
+    list[neighborCount[v]++] = u;
+}
+
+void EdgeRecombinationCrossover::removeNeighbor(int v, int u)
+{
+    int *list = neighbors.data() + MAX_NEIGHBORS * v;
+    for (int i = 0; i < neighborCount[v]; ++i)
+    {
+        if (list[i] == u)
+        {
+            list[i] = list[--neighborCount[v]];
+            return;
+        }
+    }
+}
+
+int EdgeRecombinationCrossover::crossover(const int *parent1, int /*parent1Weight*/, const int *parent2, int *child, std::mt19937 &rng)
+{
+    std::fill(neighborCount.begin(), neighborCount.end(), 0);
+    for (const int *parent : {parent1, parent2})
+    {
+        for (int i = 0; i < vertexCount; ++i)
+        {
+            const int v = parent[i];
+            addNeighbor(v, parent[(i + vertexCount - 1) % vertexCount]);
+            addNeighbor(v, parent[(i + 1) % vertexCount]);
+        }
+    }
+
+    std::iota(unvisited.begin(), unvisited.end(), 0);
+    std::iota(unvisitedIndex.begin(), unvisitedIndex.end(), 0);
+    int unvisitedCount = vertexCount;
+
+    int current = parent1[0];
+    for (int k = 0; k < vertexCount; ++k)
+    {
+        child[k] = current;
+
+        // Swap-remove the current vertex from the unvisited vertices
+        const int last = unvisited[--unvisitedCount];
+        unvisited[unvisitedIndex[current]] = last;
+        unvisitedIndex[last] = unvisitedIndex[current];
+
+        // Neighbors of the current vertex are never visited, so the lists hold only unvisited vertices
+        const int *list = neighbors.data() + MAX_NEIGHBORS * current;
+        for (int i = 0; i < neighborCount[current]; ++i)
+        {
+            removeNeighbor(list[i], current);
+        }
+
+        if (unvisitedCount == 0)
+            break;
+
+        int next = -1;
+        int ties = 0;
+        for (int i = 0; i < neighborCount[current]; ++i)
+        {
+            const int u = list[i];
+            if (next < 0 || neighborCount[u] < neighborCount[next])
+            {
+                next = u;
+                ties = 1;
+            }
+            else if (neighborCount[u] == neighborCount[next] && rng() % ++ties == 0)
+            {
+                next = u;
+            }
+        }
+
+        current = next >= 0 ? next : unvisited[rng() % unvisitedCount];
+    }
+
+    return evaluate(child);
+}
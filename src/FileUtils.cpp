@@ -1,6 +1,8 @@
 #include "FileUtils.hpp"
+#include "Logger.hpp"
 #include <iostream>
 #include <fstream>
+#include <cstdio>
 
 GraphMatrix *FileUtils::loadGraph(std::string filePath)
 {
@@ -31,11 +33,37 @@ GraphMatrix *FileUtils::loadGraph(std::string filePath)
     int optimum;
     fin >> optimum;
     graph->setOptimum(optimum);
+    graph->directed = !graph->isSymmetric();
 
     fin.close();
     return graph;
 }
 
+std::vector<int> FileUtils::loadTour(std::string filePath)
+{
+    std::vector<int> tour;
+    std::ifstream fin(filePath);
+
+    if (!fin)
+    {
+        return tour;
+    }
+
+    std::string token;
+    while (fin >> token && token != "TOUR_SECTION")
+    {
+    }
+
+    int vertex;
+    while (fin >> vertex && vertex != -1)
+    {
+        tour.push_back(vertex - 1);
+    }
+
+    fin.close();
+    return tour;
+}
+
 void FileUtils::writeInstanceTestHeader(std::string filePath)
 {
     std::ofstream fout(filePath);
@@ -44,8 +72,10 @@ void FileUtils::writeInstanceTestHeader(std::string filePath)
         return;
 
     // Error- prcentage difference between calculated weight and the optimal weight
+    // (the lower bound if the optimum is unknown), gap - percentage difference between the weight and the lower bound
 
-    fout << "instance, number of vertices, execution time [ns], error [%], path weight, path\n";
+    fout << "instance, number of vertices, execution time [ns], error [%], path weight, lower bound, gap [%], restarts, "
+         << profileHeader() << ", path\n";
     fout.close();
 }
 
@@ -68,12 +98,617 @@ void FileUtils::appendTestResult(std::string filePath, TestResult testResult)
         << ", "
         << testResult.path.weight
         << ", "
+        << testResult.path.lowerBound
+        << ", "
+        << testResult.path.gap
+        << ", "
+        << testResult.path.restartCount
+        << ", "
+        << profileToStr(testResult.path.profile)
+        << ", "
         << pathToStr(testResult.path.vertices)
         << "\n";
 
     ofs.close();
 }
 
+void FileUtils::writeNumaBenchmarkHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "instance, number of vertices, placement, threads, execution time [ns], error [%], path weight, "
+         << "node, islands, evaluations, estimated matrix bandwidth [MB/s], local allocations, remote allocations\n";
+    fout.close();
+}
+
+void FileUtils::appendNumaBenchmarkResult(std::string filePath, TestResult testResult, std::string placement, int threadCount, std::vector<NodeStatistics> nodeStatistics)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    for (const NodeStatistics &stats : nodeStatistics)
+    {
+        ofs << testResult.instanceName
+            << ", "
+            << testResult.vertexCount
+            << ", "
+            << placement
+            << ", "
+            << threadCount
+            << ", "
+            << testResult.elapsedTime
+            << ", "
+            << testResult.prd
+            << ", "
+            << testResult.path.weight
+            << ", "
+            << stats.node
+            << ", "
+            << stats.islandCount
+            << ", "
+            << stats.evaluations
+            << ", "
+            << stats.matrixBandwidthMBs
+            << ", "
+            << stats.localAllocations
+            << ", "
+            << stats.remoteAllocations
+            << "\n";
+    }
+
+    ofs.close();
+}
+
+void FileUtils::writeOptTourCheckHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "instance, number of vertices, execution time [ns], path weight, opt tour weight, gap to opt tour [%], improving moves, average step [ns]\n";
+    fout.close();
+}
+
+void FileUtils::appendOptTourCheckResult(std::string filePath, TestResult testResult, int optTourWeight, unsigned long long improvingMoves, double averageStepNs)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << testResult.instanceName
+        << ", "
+        << testResult.vertexCount
+        << ", "
+        << testResult.elapsedTime
+        << ", "
+        << testResult.path.weight
+        << ", "
+        << optTourWeight
+        << ", "
+        << 100.0 * (testResult.path.weight - optTourWeight) / optTourWeight
+        << ", "
+        << improvingMoves
+        << ", "
+        << averageStepNs
+        << "\n";
+
+    ofs.close();
+}
+
+void FileUtils::writeCrossoverBenchmarkHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    // Execution time is the time to target only if the target was reached
+    fout << "instance, number of vertices, crossover, target error [%], target reached, execution time [ns], error [%], path weight, evaluations\n";
+    fout.close();
+}
+
+void FileUtils::appendCrossoverBenchmarkResult(std::string filePath, TestResult testResult, std::string crossover, float targetPrd, bool reached, unsigned long long evaluations)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << testResult.instanceName
+        << ", "
+        << testResult.vertexCount
+        << ", "
+        << crossover
+        << ", "
+        << targetPrd
+        << ", "
+        << (reached ? "yes" : "no")
+        << ", "
+        << testResult.elapsedTime
+        << ", "
+        << testResult.prd
+        << ", "
+        << testResult.path.weight
+        << ", "
+        << evaluations
+        << "\n";
+
+    ofs.close();
+}
+
+void FileUtils::writeCrossoverThroughputHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "instance, number of vertices, crossover, children, children per second, average parents weight, average child weight, "
+         << "child to parents weight ratio, better than both parents [%], inherited edges [%]\n";
+    fout.close();
+}
+
+void FileUtils::appendCrossoverThroughputResult(std::string filePath, std::string instanceName, int vertexCount, std::string crossover, int childCount,
+                                                double childrenPerSecond, double averageParentsWeight, double averageChildWeight,
+                                                double weightRatio, double betterPercent, double inheritedPercent)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << instanceName
+        << ", "
+        << vertexCount
+        << ", "
+        << crossover
+        << ", "
+        << childCount
+        << ", "
+        << childrenPerSecond
+        << ", "
+        << averageParentsWeight
+        << ", "
+        << averageChildWeight
+        << ", "
+        << weightRatio
+        << ", "
+        << betterPercent
+        << ", "
+        << inheritedPercent
+        << "\n";
+
+    ofs.close();
+}
+
+void FileUtils::writePortfolioHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "instance, run, configuration, description, status, winner, rounds, time [ms], steps, path weight, error [%], "
+         << "lower bound, gap [%]\n";
+    fout.close();
+}
+
+void FileUtils::appendPortfolioResult(std::string filePath, std::string instanceName, int run, Path path, std::vector<PortfolioRecord> records)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    for (const PortfolioRecord &record : records)
+    {
+        ofs << instanceName
+            << ", "
+            << run
+            << ", "
+            << record.configuration
+            << ", "
+            << record.description
+            << ", "
+            << record.status
+            << ", "
+            << (record.winner ? "yes" : "no")
+            << ", "
+            << record.rounds
+            << ", "
+            << record.timeMs
+            << ", "
+            << record.steps
+            << ", "
+            << record.bestWeight
+            << ", "
+            << record.prd
+            << ", "
+            << path.lowerBound
+            << ", "
+            << (path.lowerBound > 0 ? 100.0 * (record.bestWeight - path.lowerBound) / path.lowerBound : 0.0)
+            << "\n";
+    }
+
+    ofs.close();
+}
+
+void FileUtils::writeAtspTransformBenchmarkHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "instance, number of vertices, solved as, engine, crossover, target error [%], target reached, execution time [ns], "
+         << "error [%], path weight, lower bound, gap [%]\n";
+    fout.close();
+}
+
+void FileUtils::appendAtspTransformBenchmarkResult(std::string filePath, TestResult testResult, AlgorithmParams params, float targetPrd, bool reached)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << testResult.instanceName
+        << ", "
+        << testResult.vertexCount
+        << ", "
+        << (params.atspTransform ? "symmetric" : "asymmetric")
+        << ", "
+        << params.engine
+        << ", "
+        << (params.engine == "lin_kernighan" ? "-" : params.crossover)
+        << ", "
+        << targetPrd
+        << ", "
+        << (reached ? "yes" : "no")
+        << ", "
+        << testResult.elapsedTime
+        << ", "
+        << testResult.prd
+        << ", "
+        << testResult.path.weight
+        << ", "
+        << testResult.path.lowerBound
+        << ", "
+        << testResult.path.gap
+        << "\n";
+
+    ofs.close();
+}
+
+void FileUtils::writeAdaptationTrace(std::string filePath, std::vector<std::string> operatorNames, std::vector<AdaptationRecord> records)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "generation, time [ms], best weight, crossover rate, mutation rate";
+    for (const std::string &name : operatorNames)
+    {
+        fout << ", p(" << name << ")";
+    }
+    fout << "\n";
+
+    for (const AdaptationRecord &record : records)
+    {
+        fout << record.generation
+             << ", "
+             << record.timeMs
+             << ", "
+             << record.bestWeight
+             << ", "
+             << record.crossoverRate
+             << ", "
+             << record.mutationRate;
+        for (double probability : record.operatorProbabilities)
+        {
+            fout << ", " << probability;
+        }
+        fout << "\n";
+    }
+    fout.close();
+}
+
+void FileUtils::writeConvergenceTrace(std::string filePath, std::vector<TraceSample> samples, unsigned long long droppedCount)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    if (droppedCount > 0)
+    {
+        LOG_WARN("trace", "Convergence trace: %llu oldest samples overwritten.", droppedCount);
+    }
+
+    fout << "time [ms], generation, best weight, mean weight, diversity\n";
+    for (const TraceSample &sample : samples)
+    {
+        fout << sample.timeNs / 1e6
+             << ", "
+             << sample.generation
+             << ", "
+             << sample.bestWeight
+             << ", "
+             << sample.meanWeight
+             << ", "
+             << sample.diversity
+             << "\n";
+    }
+    fout.close();
+}
+
+std::vector<TraceSample> FileUtils::loadConvergenceTrace(std::string filePath)
+{
+    std::vector<TraceSample> samples;
+    std::ifstream fin(filePath);
+
+    if (!fin)
+        return samples;
+
+    std::string line;
+    std::getline(fin, line);
+    while (std::getline(fin, line))
+    {
+        TraceSample sample;
+        double timeMs;
+        if (sscanf(line.c_str(), "%lf, %llu, %i, %lf, %f", &timeMs, &sample.generation, &sample.bestWeight, &sample.meanWeight, &sample.diversity) == 5)
+        {
+            sample.timeNs = (unsigned long long)(timeMs * 1e6);
+            samples.push_back(sample);
+        }
+    }
+    fin.close();
+    return samples;
+}
+
+void FileUtils::writeTimeToTargetHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    // Runs sorted by the time to reach the target, probability - (i - 0.5) / runs for the i-th run of them
+    fout << "target error [%], target weight, run, time [ms], probability\n";
+    fout.close();
+}
+
+void FileUtils::appendTimeToTarget(std::string filePath, float targetPrd, int targetWeight, int run, double timeMs, double probability)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << targetPrd
+        << ", "
+        << targetWeight
+        << ", "
+        << run
+        << ", "
+        << timeMs
+        << ", "
+        << probability
+        << "\n";
+
+    ofs.close();
+}
+
+void FileUtils::writeRegressionBaseline(std::string filePath, std::vector<RegressionSample> samples)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "instance, seed, time to target [ms], error [%]\n";
+    for (const RegressionSample &sample : samples)
+    {
+        fout << sample.instanceName
+             << ", "
+             << sample.seed
+             << ", "
+             << sample.timeToTargetMs
+             << ", "
+             << sample.prd
+             << "\n";
+    }
+    fout.close();
+}
+
+std::vector<RegressionSample> FileUtils::loadRegressionBaseline(std::string filePath)
+{
+    std::vector<RegressionSample> samples;
+    std::ifstream fin(filePath);
+
+    if (!fin)
+        return samples;
+
+    std::string line;
+    std::getline(fin, line);
+    while (std::getline(fin, line))
+    {
+        char name[256];
+        RegressionSample sample;
+        if (sscanf(line.c_str(), "%255[^,], %u, %lf, %f", name, &sample.seed, &sample.timeToTargetMs, &sample.prd) == 4)
+        {
+            sample.instanceName = name;
+            samples.push_back(sample);
+        }
+    }
+    fin.close();
+    return samples;
+}
+
+void FileUtils::writeRegressionHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    // Medians and the Mann-Whitney test of the runs left after removing outliers,
+    // p-value - probability of the current runs being this much worse by chance
+    fout << "instance, metric, baseline runs, current runs, baseline median, current median, U, p-value, regression\n";
+    fout.close();
+}
+
+void FileUtils::appendRegressionResult(std::string filePath, std::string instanceName, std::string metric, int baselineCount, int currentCount,
+                                       double baselineMedian, double currentMedian, double u, double pValue, bool regression)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << instanceName
+        << ", "
+        << metric
+        << ", "
+        << baselineCount
+        << ", "
+        << currentCount
+        << ", "
+        << baselineMedian
+        << ", "
+        << currentMedian
+        << ", "
+        << u
+        << ", "
+        << pValue
+        << ", "
+        << (regression ? "yes" : "no")
+        << "\n";
+
+    ofs.close();
+}
+
+void FileUtils::writeAllocationCheckHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    fout << "instance, number of vertices, warm-up generations, checked generations, allocations, allocated [B]";
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        fout << ", " << PhaseProfile::getName((Phase)phase) << " allocations";
+    }
+    fout << ", result\n";
+    fout.close();
+}
+
+void FileUtils::appendAllocationCheckResult(std::string filePath, std::string instanceName, int vertexCount, int warmupGenerations, int generationCount,
+                                            unsigned long long allocations, unsigned long long bytes, std::vector<unsigned long long> phaseAllocations)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << instanceName
+        << ", "
+        << vertexCount
+        << ", "
+        << warmupGenerations
+        << ", "
+        << generationCount
+        << ", "
+        << allocations
+        << ", "
+        << bytes;
+    for (unsigned long long count : phaseAllocations)
+    {
+        ofs << ", " << count;
+    }
+    ofs << ", " << (allocations == 0 ? "pass" : "fail") << "\n";
+
+    ofs.close();
+}
+
+void FileUtils::writeInitializationBenchmarkHeader(std::string filePath)
+{
+    std::ofstream fout(filePath);
+
+    if (!fout)
+        return;
+
+    // Execution time is the time to target only if the target was reached
+    fout << "instance, number of vertices, initialization, share, initialization time [ns], initial error [%], "
+         << "target error [%], target reached, execution time [ns], error [%], path weight, evaluations\n";
+    fout.close();
+}
+
+void FileUtils::appendInitializationBenchmarkResult(std::string filePath, TestResult testResult, AlgorithmParams params, unsigned long initializationTimeNs,
+                                                    float initialPrd, float targetPrd, bool reached, unsigned long long evaluations)
+{
+    std::ofstream ofs;
+
+    ofs.open(filePath, std::ios_base::app);
+
+    if (!ofs)
+        return;
+
+    ofs << testResult.instanceName
+        << ", "
+        << testResult.vertexCount
+        << ", "
+        << params.initialization
+        << ", "
+        << (params.initialization == "random" ? 0.0 : params.initializationShare)
+        << ", "
+        << initializationTimeNs
+        << ", "
+        << initialPrd
+        << ", "
+        << targetPrd
+        << ", "
+        << (reached ? "yes" : "no")
+        << ", "
+        << testResult.elapsedTime
+        << ", "
+        << testResult.prd
+        << ", "
+        << testResult.path.weight
+        << ", "
+        << evaluations
+        << "\n";
+
+    ofs.close();
+}
+
 void FileUtils::appendRandomInstanceTestResult(std::string filePath, int vertexCount, unsigned long elapsedTime)
 {
     std::ofstream ofs;
@@ -102,6 +737,46 @@ void FileUtils::writeRandomInstanceTestHeader(std::string filePath)
     fout.close();
 }
 
+std::string FileUtils::profileHeader()
+{
+    std::string res = "generations, evaluations, evaluations per second, allocations, allocated [B], peak RSS [kB], arena [B], arena in use [B]";
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        const std::string name = PhaseProfile::getName((Phase)phase);
+        res += ", " + name + " [ns], " + name + " calls, " + name + " evaluations, " + name + " allocations, " + name + " allocated [B]";
+    }
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        for (int event = 0; event < PerfCounters::EVENT_COUNT; ++event)
+        {
+            res += std::string(", ") + PhaseProfile::getName((Phase)phase) + " " + PerfCounters::getName((PerfCounters::Event)event);
+        }
+    }
+    return res;
+}
+
+std::string FileUtils::profileToStr(const PhaseProfile &profile)
+{
+    std::string res = std::to_string(profile.generations) + ", " + std::to_string(profile.evaluationCount) + ", " +
+                      std::to_string((unsigned long long)profile.getEvaluationsPerSecond()) + ", " +
+                      std::to_string(profile.allocationCount) + ", " + std::to_string(profile.allocatedByteCount) + ", " +
+                      std::to_string(profile.peakRssKb) + ", " + std::to_string(profile.arenaBytes) + ", " + std::to_string(profile.arenaInUseBytes);
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        res += ", " + std::to_string(profile.timeNs[phase]) + ", " + std::to_string(profile.calls[phase]) + ", " +
+               std::to_string(profile.evaluations[phase]) + ", " + std::to_string(profile.allocations[phase]) + ", " +
+               std::to_string(profile.allocatedBytes[phase]);
+    }
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        for (int event = 0; event < PerfCounters::EVENT_COUNT; ++event)
+        {
+            res += ", " + std::to_string(profile.events[phase][event]);
+        }
+    }
+    return res;
+}
+
 std::string FileUtils::pathToStr(std::vector<int> path)
 {
     std::string res;
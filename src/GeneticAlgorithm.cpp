@@ -1,30 +1,122 @@
 #include "GeneticAlgorithm.hpp"
+#include "Logger.hpp"
 #include <algorithm>
 #include <numeric>
 #include <iterator>
+#include <thread>
 
-GeneticAlgorithm::GeneticAlgorithm(GraphMatrix *graph, AlgorithmParams params)
+#include "Construction.hpp"
+#include "FileUtils.hpp"
+
+// Adaptive pursuit of the crossover operators (updated after every child) and of the rates (updated every generation):
+// share of the selections spread over all arms, adaptation rate of the estimates and learning rate of the probabilities
+static const double OPERATOR_MIN_SHARE = 0.2;
+static const double OPERATOR_ALPHA = 0.05;
+static const double OPERATOR_BETA = 0.05;
+static const double RATE_MIN_SHARE = 0.2;
+static const double RATE_ALPHA = 0.3;
+static const double RATE_BETA = 0.3;
+
+static const float CROSSOVER_RATES[] = {0.25f, 0.5f, 0.75f, 1.0f};
+static const float MUTATION_RATES[] = {0.0f, 0.05f, 0.1f, 0.2f, 0.4f};
+
+GeneticAlgorithm::GeneticAlgorithm(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound)
 {
+    // Adaptive rates choose the number of children (up to the population size) in every generation
+    if (params.adaptiveRates)
+    {
+        params.nextGenPopulationCount = params.populationCount;
+    }
     this->params = params;
     this->graph = graph;
+    this->lowerBound = lowerBound;
     this->vertexCount = graph->getVertexCount();
 
+    this->rng.seed(params.seed != 0 ? params.seed : rand());
+
     this->population = new Individual *[params.populationCount];
     this->nextGenPopulation = new Individual *[params.nextGenPopulationCount];
     this->matingPool = new Individual *[params.matingPoolSize];
+    this->selection = Selection(params.selection, params.tournamentSize, params.selectionPressure);
 
     const int jointPopulCount = params.populationCount + params.nextGenPopulationCount;
 
     // Vector for holding a joint population of current population and next population during succession
     this->jointPopul.resize(jointPopulCount);
+    this->visited.resize(vertexCount);
+
+    // All paths of both populations are stored in one contiguous arena.
+    // Writing it here places its pages on the NUMA node of the thread that constructs the algorithm (first touch).
+    const size_t arenaSize = (size_t)jointPopulCount * vertexCount;
+    this->pathArena = new int[arenaSize];
+    std::fill(pathArena, pathArena + arenaSize, 0);
 
     for (int i = 0; i < params.populationCount; ++i)
     {
-        population[i] = new Individual(vertexCount, graph);
+        population[i] = new Individual(vertexCount, graph, pathArena + (size_t)i * vertexCount);
     }
     for (int i = 0; i < params.nextGenPopulationCount; ++i)
     {
-        nextGenPopulation[i] = new Individual(vertexCount, graph);
+        const size_t offset = (size_t)(params.populationCount + i) * vertexCount;
+        nextGenPopulation[i] = new Individual(vertexCount, graph, pathArena + offset);
+    }
+
+    bool useLocalSearch = params.localSearch != "none";
+    if ((params.localSearch == "two_opt" || params.localSearch == "lin_kernighan") && graph->directed)
+    {
+        LOG_WARN("ga", "%s requires a symmetric instance, local search disabled.", params.localSearch.c_str());
+        useLocalSearch = false;
+    }
+
+    bool crossoverNeedsCandidates = Crossover::needsCandidates(params.crossover, graph);
+    for (const std::string &name : params.adaptiveOperators)
+    {
+        crossoverNeedsCandidates |= params.crossover == "adaptive" && Crossover::needsCandidates(name, graph);
+    }
+    if (useLocalSearch || crossoverNeedsCandidates || params.initialization != "random")
+    {
+        this->candidates = LowerBound::createCandidateList(graph, params, lowerBound);
+    }
+
+    if (params.crossover == "adaptive")
+    {
+        for (const std::string &name : params.adaptiveOperators)
+        {
+            // eax and gpx fall back to ox1 on asymmetric instances
+            if (Crossover::needsSymmetricGraph(name) && graph->directed)
+                continue;
+            adaptiveCrossovers.push_back(Crossover::create(name, graph, candidates));
+            adaptiveCrossoverNames.push_back(name);
+        }
+    }
+    if (adaptiveCrossovers.empty())
+    {
+        this->crossover = Crossover::create(params.crossover, graph, candidates);
+    }
+    else
+    {
+        this->operatorPursuit = new AdaptivePursuit(adaptiveCrossovers.size(), OPERATOR_MIN_SHARE, OPERATOR_ALPHA, OPERATOR_BETA);
+    }
+
+    this->childCount = params.nextGenPopulationCount;
+    this->mutationProbability = params.mutationProbability;
+    if (params.adaptiveRates)
+    {
+        this->crossoverRatePursuit = new AdaptivePursuit(std::size(CROSSOVER_RATES), RATE_MIN_SHARE, RATE_ALPHA, RATE_BETA);
+        this->mutationRatePursuit = new AdaptivePursuit(std::size(MUTATION_RATES), RATE_MIN_SHARE, RATE_ALPHA, RATE_BETA);
+    }
+
+    if (useLocalSearch)
+    {
+        // Edges to a vertex differ from edges from it only in asymmetric graphs
+        this->inCandidates = graph->directed ? new CandidateList(graph, params.candidateListSize, true) : candidates;
+
+        if (params.localSearch == "two_opt")
+            this->twoOpt = new TwoOpt(graph, candidates, params.twoLevelListMinSize);
+        else if (params.localSearch == "or_opt")
+            this->orOpt = new OrOpt(graph, candidates, inCandidates, params.twoLevelListMinSize);
+        else if (params.localSearch == "lin_kernighan")
+            this->lk = new LinKernighan(graph, candidates, params.lkDepth, params.twoLevelListMinSize);
     }
 
     setMinError();
@@ -44,21 +136,43 @@ GeneticAlgorithm::~GeneticAlgorithm()
     delete[] population;
     delete[] nextGenPopulation;
     delete[] matingPool;
+    delete[] pathArena;
+    delete twoOpt;
+    delete orOpt;
+    delete lk;
+    delete crossover;
+    for (Crossover *adaptiveCrossover : adaptiveCrossovers)
+    {
+        delete adaptiveCrossover;
+    }
+    delete operatorPursuit;
+    delete crossoverRatePursuit;
+    delete mutationRatePursuit;
+    if (inCandidates != candidates)
+    {
+        delete inCandidates;
+    }
+    delete candidates;
 }
 
 void GeneticAlgorithm::setMinError()
 {
-    if (this->vertexCount <= 70)
+    this->params.minError = getMinError(graph->getOriginalVertexCount());
+}
+
+float GeneticAlgorithm::getMinError(int vertexCount)
+{
+    if (vertexCount <= 70)
     {
-        this->params.minError = 0.0;
+        return 0.0;
     }
-    else if (this->vertexCount <= 350)
+    else if (vertexCount <= 350)
     {
-        this->params.minError = 0.5;
+        return 0.5;
     }
     else
     {
-        this->params.minError = 1.5;
+        return 1.5;
     }
 }
 
@@ -68,7 +182,7 @@ void GeneticAlgorithm::checkPopulation(Individual **population, int populationCo
     {
         if (!pathIsValid(population[i]->path))
         {
-            printf("error\n");
+            LOG_ERROR("ga", "Invalid path of individual %i", i);
         }
     }
 }
@@ -78,75 +192,363 @@ void GeneticAlgorithm::copyPath(int *fromPath, int *toPath)
     std::copy(fromPath, fromPath + vertexCount, toPath);
 }
 
-void GeneticAlgorithm::copySection(int *fromArray, int *toArray, int index1, int index2)
+Path GeneticAlgorithm::solveTSP()
 {
-    std::copy(fromArray + index1, fromArray + index2 + 1, toArray + index1);
+    start();
+    while (!step())
+    {
+    }
+    return finish();
 }
 
-Path GeneticAlgorithm::solveTSP()
+void GeneticAlgorithm::start()
 {
     timer.start();
+    profile.startMemory();
+    deadline.start(params.maxExecutionTimeMs);
+    convergenceTrace.reset(params.traceFile.empty() ? 0 : params.traceCapacity);
+    resetAdaptationTrace();
+    openPerfCounters();
+
+    // Create the initial population
+    {
+        PROFILE_PHASE(profile, PHASE_INITIALIZATION);
+        initializePopulation();
+    }
+    recordTraceSample();
+}
+
+bool GeneticAlgorithm::step()
+{
+    adaptParameters();
+    // Selection before the mutations, while the population is sorted (rank selection)
+    createMatingPool();
+    executeMutations();
+    executeCrossover();
+    // printCurrentPopulationWeights();
+    createNewPopulation();
+    improveElites();
+    generation++;
+    if (params.progressInterval > 0 && generation % params.progressInterval == 0)
+    {
+        printProgress();
+    }
+    updateStagnation();
+    if (params.restart != "none" && isStagnating())
+    {
+        PROFILE_PHASE(profile, PHASE_RESTART);
+        restart();
+    }
+    if (convergenceTrace.isEnabled() && (generation % params.traceInterval == 0 || population[0]->getPathWeight() < tracedBestWeight))
+    {
+        recordTraceSample();
+    }
+    return endConditionIsMet();
+}
+
+void GeneticAlgorithm::recordTraceSample()
+{
+    if (!convergenceTrace.isEnabled())
+    {
+        return;
+    }
+
+    // Weights of the original instance of a transformed graph
+    TraceSample sample;
+    sample.timeNs = timer.getElapsedNs();
+    sample.generation = generation;
+    sample.bestWeight = population[0]->getPathWeight() - graph->weightOffset;
+    sample.meanWeight = getMeanWeight() - graph->weightOffset;
+    sample.diversity = getDiversity();
+    convergenceTrace.record(sample);
+    tracedBestWeight = population[0]->getPathWeight();
+}
+
+void GeneticAlgorithm::attachThread()
+{
+    profile.attachThread();
+}
+
+void GeneticAlgorithm::detachThread()
+{
+    profile.detachThread();
+}
+
+Path GeneticAlgorithm::finish()
+{
+    if (adaptationRecordCount > 0)
+    {
+        // Oldest record first
+        if (adaptationRecordCount > adaptationTrace.size())
+        {
+            std::rotate(adaptationTrace.begin(), adaptationTrace.begin() + adaptationRecordCount % adaptationTrace.size(), adaptationTrace.end());
+        }
+        else
+        {
+            adaptationTrace.resize(adaptationRecordCount);
+        }
+        FileUtils::writeAdaptationTrace(params.adaptiveTrace, adaptiveCrossoverNames, adaptationTrace);
+    }
 
-    // Crate random population
-    initializePopulation();
+    if (convergenceTrace.isEnabled())
+    {
+        recordTraceSample();
+        FileUtils::writeConvergenceTrace(params.traceFile, convergenceTrace.getSamples(), convergenceTrace.getDroppedCount());
+    }
+
+    profile.generations = generation;
+    profile.evaluationCount = evaluationCount;
+    profile.runTimeNs = timer.getElapsedNs();
+    profile.finishMemory();
+    if (profile.perfCounters != NULL)
+    {
+        profile.detachCounters();
+        perfCounters.close();
+        profile.printEvents();
+    }
 
-    do
+    if (lk != NULL)
     {
-        executeMutations();
-        createMatingPool();
-        executeCrossover();
-        // printCurrentPopulationWeights();
-        createNewPopulation();
-        printBestPrd();
-    } while (!endConditionIsMet());
+        LOG_INFO("ga", "Lin-Kernighan improving moves: %llu, average step: %.0f ns", lk->getImprovingMoves(), lk->getAverageStepNs());
+    }
 
     return getResult();
 }
 
 void GeneticAlgorithm::createNewPopulation()
 {
+    PROFILE_PHASE(profile, PHASE_SUCCESSION);
     std::copy(population, population + params.populationCount, jointPopul.begin());
-    std::copy(nextGenPopulation, nextGenPopulation + params.nextGenPopulationCount, jointPopul.begin() + params.populationCount);
+    std::copy(nextGenPopulation, nextGenPopulation + childCount, jointPopul.begin() + params.populationCount);
+    const auto jointEnd = jointPopul.begin() + params.populationCount + childCount;
 
     // Sort joint population from best individual to worst
-    std::sort(jointPopul.begin(), jointPopul.end(), [](Individual *a, Individual *b)
+    std::sort(jointPopul.begin(), jointEnd, [](Individual *a, Individual *b)
               { return a->getPathWeight() < b->getPathWeight(); });
 
-    // Copy first populationCount number of inviduals from joint population to the current population
-    for (int i = 0; i < params.populationCount; i++)
+    // First populationCount inviduals of the joint population become the current population,
+    // the rest is reused as the next generation population (individuals are moved, not copied,
+    // so that no path is overwritten before it is moved)
+    std::copy(jointPopul.begin(), jointPopul.begin() + params.populationCount, population);
+    std::copy(jointPopul.begin() + params.populationCount, jointEnd, nextGenPopulation);
+
+    fittestIndividual = population[0];
+}
+
+void GeneticAlgorithm::applyLocalSearch(Individual *individual)
+{
+    if (twoOpt == NULL && orOpt == NULL && lk == NULL)
+        return;
+
+    PROFILE_PHASE(profile, PHASE_LOCAL_SEARCH);
+    // The gain is computed by delta evaluation, no need to evaluate the whole path again
+    if (twoOpt != NULL)
+    {
+        individual->pathWeight -= twoOpt->optimize(individual->path, params.localSearchBudget);
+    }
+    else if (orOpt != NULL)
+    {
+        individual->pathWeight -= orOpt->optimize(individual->path, params.localSearchBudget);
+    }
+    else if (lk != NULL)
+    {
+        individual->pathWeight -= lk->optimize(individual->path, params.localSearchBudget);
+    }
+}
+
+void GeneticAlgorithm::improveElites()
+{
+    if ((twoOpt == NULL && orOpt == NULL && lk == NULL) || params.localSearchTarget != "elites")
+        return;
+
+    const int eliteCount = std::min(params.eliteCount, params.populationCount);
+    for (int i = 0; i < eliteCount; ++i)
     {
-        copyPath(jointPopul[i]->path, population[i]->path);
-        population[i]->pathWeight = jointPopul[i]->pathWeight;
+        applyLocalSearch(population[i]);
     }
 
-    fittestIndividual = jointPopul[0];
+    // Population stays sorted from the best individual
+    std::sort(population, population + eliteCount, [](Individual *a, Individual *b)
+              { return a->getPathWeight() < b->getPathWeight(); });
+    if (population[0]->getPathWeight() < fittestIndividual->getPathWeight())
+    {
+        fittestIndividual = population[0];
+    }
 }
 
-void GeneticAlgorithm::createMatingPool()
+void GeneticAlgorithm::adaptParameters()
 {
-    // Create mating pool by tournament selection
-    tournamentSelection();
+    if (crossoverRatePursuit != NULL)
+    {
+        if (crossoverRateArm >= 0)
+        {
+            const double evaluations = std::max(1ULL, evaluationCount - generationStartEvaluations);
+            const double improvement = std::max(0.0, generationStartMeanWeight - getMeanWeight()) / generationStartMeanWeight;
+            crossoverRatePursuit->update(crossoverRateArm, improvement / evaluations);
+            mutationRatePursuit->update(mutationRateArm, improvement / evaluations);
+        }
+
+        crossoverRateArm = crossoverRatePursuit->select(rng);
+        mutationRateArm = mutationRatePursuit->select(rng);
+        // Children are created in pairs
+        childCount = std::max(2, 2 * (int)(CROSSOVER_RATES[crossoverRateArm] * params.populationCount / 2));
+        mutationProbability = MUTATION_RATES[mutationRateArm];
+
+        generationStartMeanWeight = getMeanWeight();
+        generationStartEvaluations = evaluationCount;
+    }
+
+    // The trace is kept only to be saved
+    if ((operatorPursuit == NULL && crossoverRatePursuit == NULL) || params.adaptiveTrace.empty())
+    {
+        return;
+    }
+
+    // Overwrites the oldest record once the buffer is full, without allocating
+    AdaptationRecord &record = adaptationTrace[adaptationRecordCount % adaptationTrace.size()];
+    record.generation = generation;
+    record.timeMs = timer.getElapsedMs();
+    record.bestWeight = population[0]->getPathWeight();
+    record.crossoverRate = childCount / (float)params.populationCount;
+    record.mutationRate = mutationProbability;
+    if (operatorPursuit != NULL)
+    {
+        const std::vector<double> &probabilities = operatorPursuit->getProbabilities();
+        std::copy(probabilities.begin(), probabilities.end(), record.operatorProbabilities.begin());
+    }
+    adaptationRecordCount++;
 }
 
-Individual *fitterIndividual(Individual *individual1, Individual *individual2)
+void GeneticAlgorithm::resetAdaptationTrace()
 {
-    return individual1->getPathWeight() < individual2->getPathWeight()
-               ? individual1
-               : individual2;
+    adaptationRecordCount = 0;
+    adaptationTrace.clear();
+    if ((operatorPursuit == NULL && crossoverRatePursuit == NULL) || params.adaptiveTrace.empty())
+    {
+        return;
+    }
+
+    AdaptationRecord empty;
+    if (operatorPursuit != NULL)
+    {
+        empty.operatorProbabilities.assign(adaptiveCrossovers.size(), 0.0);
+    }
+    adaptationTrace.assign(params.traceCapacity, empty);
 }
 
-void GeneticAlgorithm::tournamentSelection()
+double GeneticAlgorithm::getMeanWeight()
 {
-    std::random_shuffle(population, population + params.populationCount);
+    double sum = 0.0;
+    for (int i = 0; i < params.populationCount; ++i)
+    {
+        sum += population[i]->getPathWeight();
+    }
+    return sum / params.populationCount;
+}
 
-    for (int i = 0; i < params.populationCount; i += 2)
+void GeneticAlgorithm::updateStagnation()
+{
+    if (fittestIndividual->getPathWeight() < stagnationBestWeight)
+    {
+        stagnationBestWeight = fittestIndividual->getPathWeight();
+        generationsWithoutImprovement = 0;
+    }
+    else
     {
-        Individual *contestant1 = population[i];
-        Individual *contestant2 = population[i + 1];
+        generationsWithoutImprovement++;
+    }
+}
 
-        Individual *winner = fitterIndividual(contestant1, contestant2);
+bool GeneticAlgorithm::isStagnating()
+{
+    if (params.maxItersWithoutImprovment > 0 && generationsWithoutImprovement >= params.maxItersWithoutImprovment)
+    {
+        return true;
+    }
+    return params.minDiversity > 0 && getDiversity() < params.minDiversity;
+}
 
-        matingPool[i / 2] = winner;
+float GeneticAlgorithm::getDiversity()
+{
+    int distinctCount = 1;
+    for (int i = 1; i < params.populationCount; ++i)
+    {
+        if (population[i]->getPathWeight() != population[i - 1]->getPathWeight())
+        {
+            distinctCount++;
+        }
+    }
+    return distinctCount / (float)params.populationCount;
+}
+
+void GeneticAlgorithm::restart()
+{
+    const int eliteCount = std::max(1, std::min(params.restartEliteCount, params.populationCount));
+
+    if (params.restart == "partial_reinit")
+    {
+        reinitialize(std::max(1, params.populationCount - (int)(params.restartShare * params.populationCount)));
+    }
+    else if (params.restart == "catastrophe")
+    {
+        reinitialize(eliteCount);
+    }
+    else if (params.restart == "double_bridge")
+    {
+        // The rest of the population becomes perturbed copies of the elites
+        for (int i = eliteCount; i < params.populationCount; ++i)
+        {
+            copyPath(population[i % eliteCount]->path, population[i]->path);
+            doubleBridge(population[i]);
+            applyLocalSearch(population[i]);
+        }
+    }
+
+    std::sort(population, population + params.populationCount, [](Individual *a, Individual *b)
+              { return a->getPathWeight() < b->getPathWeight(); });
+    fittestIndividual = population[0];
+
+    generationsWithoutImprovement = 0;
+    restartCount++;
+    LOG_INFO("ga", "Restart %i (%s)", restartCount, params.restart.c_str());
+}
+
+void GeneticAlgorithm::reinitialize(int keep)
+{
+    const int constructedCount = params.initialization == "random" ? 0 : keep + (int)(params.initializationShare * (params.populationCount - keep));
+    initializeIndividuals(keep, params.populationCount, constructedCount, rng());
+    countEvaluations(params.populationCount - keep);
+}
+
+void GeneticAlgorithm::doubleBridge(Individual *individual)
+{
+    if (vertexCount < 8)
+    {
+        return;
+    }
+
+    // A B C D becomes A C B D
+    const int index1 = randomInt(1, vertexCount - 3);
+    const int index2 = randomInt(index1 + 1, vertexCount - 2);
+    const int index3 = randomInt(index2 + 1, vertexCount - 1);
+    std::rotate(individual->path + index1, individual->path + index2, individual->path + index3);
+    individual->updatePathWeight();
+    countEvaluations(1);
+}
+
+int GeneticAlgorithm::getRestartCount()
+{
+    return restartCount;
+}
+
+void GeneticAlgorithm::createMatingPool()
+{
+    PROFILE_PHASE(profile, PHASE_SELECTION);
+    selection.prepare(population, params.populationCount);
+
+    for (int i = 0; i < params.matingPoolSize; ++i)
+    {
+        matingPool[i] = population[selection.select(population, params.populationCount, rng)];
     }
 }
 
@@ -158,17 +560,43 @@ bool GeneticAlgorithm::endConditionIsMet()
         return false;
     }
 
+    if (stopFlag != NULL && stopFlag->load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
     if (executionTimeLimit())
     {
-        printf("Reached the execution time limit\n");
+        LOG_INFO("ga", "Reached the execution time limit");
         return true;
     }
 
     // Reached minimum error
-    float error = getError(fittestIndividual->getPathWeight());
+    // minError is a percentage (prd), as in the thresholds of setMinError
+    float error = getPrd(fittestIndividual->getPathWeight());
     if (error <= params.minError)
     {
-        printf("Reached minimum error: %.4f.\n", params.minError);
+        LOG_INFO("ga", "Reached minimum error: %.4f.", params.minError);
+        if (stopFlag != NULL)
+        {
+            stopFlag->store(true, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    if (params.restart == "none" && isStagnating())
+    {
+        LOG_INFO("ga", "Stagnation after %i generations without improvement.", generationsWithoutImprovement);
+        return true;
+    }
+
+    if (lowerBound != NULL && lowerBound->getGap(fittestIndividual->getPathWeight()) <= params.maxGap)
+    {
+        LOG_INFO("ga", "Reached the lower bound gap: %.4f.", params.maxGap);
+        if (stopFlag != NULL)
+        {
+            stopFlag->store(true, std::memory_order_relaxed);
+        }
         return true;
     }
 
@@ -177,16 +605,75 @@ bool GeneticAlgorithm::endConditionIsMet()
 
 void GeneticAlgorithm::initializePopulation()
 {
-    for (int i = 0; i < params.populationCount; ++i)
+    Timer initializationTimer;
+    initializationTimer.start();
+
+    const int constructedCount = params.initialization == "random" ? 0 : (int)(params.initializationShare * params.populationCount);
+
+    int threadCount = params.initializationThreadCount > 0 ? params.initializationThreadCount : std::thread::hardware_concurrency();
+    threadCount = std::max(1, std::min(threadCount, params.populationCount));
+
+    // Seeds are drawn before starting the threads, so the population does not depend on thread scheduling
+    std::vector<unsigned int> seeds(threadCount);
+    for (unsigned int &seed : seeds)
     {
-        population[i]->setRandomPath();
+        seed = rng();
+    }
+
+    if (threadCount == 1)
+    {
+        initializeIndividuals(0, params.populationCount, constructedCount, seeds[0]);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            const int first = (long long)params.populationCount * t / threadCount;
+            const int last = (long long)params.populationCount * (t + 1) / threadCount;
+            threads.emplace_back(&GeneticAlgorithm::initializeIndividuals, this, first, last, constructedCount, seeds[t]);
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+    }
+    countEvaluations(params.populationCount);
+
+    // Rank selection expects the population sorted from the best individual, as left by createNewPopulation
+    std::sort(population, population + params.populationCount, [](Individual *a, Individual *b)
+              { return a->getPathWeight() < b->getPathWeight(); });
+
+    initialBestWeight = population[0]->getPathWeight();
+    initializationTimeNs = initializationTimer.getElapsedNs();
+}
+
+void GeneticAlgorithm::initializeIndividuals(int first, int last, int constructedCount, unsigned int seed)
+{
+    std::mt19937 threadRng(seed);
+    // Every thread has its own buffers of the construction heuristic
+    Construction *construction = first < constructedCount ? new Construction(graph, candidates) : NULL;
+
+    for (int i = first; i < last; ++i)
+    {
+        if (i < constructedCount)
+        {
+            construction->construct(params.initialization, population[i]->path, threadRng);
+        }
+        else
+        {
+            population[i]->setRandomPath(threadRng);
+        }
         population[i]->updatePathWeight();
     }
+
+    delete construction;
 }
 
 void GeneticAlgorithm::executeCrossover()
 {
-    for (int i = 0; i < params.nextGenPopulationCount / 2; ++i)
+    PROFILE_PHASE(profile, PHASE_CROSSOVER);
+    for (int i = 0; i < childCount / 2; ++i)
     {
         // Get two random, unique parents from mating pool
         int index1 = randomInt(0, params.matingPoolSize - 2);
@@ -198,102 +685,102 @@ void GeneticAlgorithm::executeCrossover()
         Individual *child1 = nextGenPopulation[2 * i];
         Individual *child2 = nextGenPopulation[2 * i + 1];
 
-        oxCrossover(parent1->path, parent2->path, child1->path, child2->path);
-        child1->updatePathWeight();
-        child2->updatePathWeight();
-    }
-}
-
-void GeneticAlgorithm::fillMissingSection(int *parent, int *child, int index1, int index2)
-{
-    int childIndex = (index2 + 1) % vertexCount;
-    int parentIndex = (index2 + 1) % vertexCount;
-
-    while (childIndex != index1)
-    {
-        int value = parent[parentIndex];
-        if (!sectionContains(value, child, index1, index2))
+        // Every child is based on one of the parents
+        if (operatorPursuit == NULL)
         {
-            child[childIndex] = value;
-            childIndex = (childIndex + 1) % vertexCount;
+            child1->pathWeight = crossover->crossover(parent1->path, parent1->getPathWeight(), parent2->path, child1->path, rng);
+            child2->pathWeight = crossover->crossover(parent2->path, parent2->getPathWeight(), parent1->path, child2->path, rng);
+        }
+        else
+        {
+            // Both children come from the same operator, rewarded by their relative improvement over the better parent
+            const int arm = operatorPursuit->select(rng);
+            Crossover *adaptiveCrossover = adaptiveCrossovers[arm];
+            child1->pathWeight = adaptiveCrossover->crossover(parent1->path, parent1->getPathWeight(), parent2->path, child1->path, rng);
+            child2->pathWeight = adaptiveCrossover->crossover(parent2->path, parent2->getPathWeight(), parent1->path, child2->path, rng);
+
+            const int betterParentWeight = std::min(parent1->getPathWeight(), parent2->getPathWeight());
+            for (Individual *child : {child1, child2})
+            {
+                operatorPursuit->update(arm, std::max(0, betterParentWeight - child->getPathWeight()) / (double)betterParentWeight);
+            }
         }
 
-        // Move to next parent index
-        parentIndex = (parentIndex + 1) % vertexCount;
+        if (params.localSearchTarget == "offspring")
+        {
+            applyLocalSearch(child1);
+            applyLocalSearch(child2);
+        }
     }
+    countEvaluations(2 * (childCount / 2));
 }
 
 int GeneticAlgorithm::randomInt(int min, int max)
 {
-    return min + rand() % (max - min + 1);
-}
-
-void GeneticAlgorithm::oxCrossover(int *parent1, int *parent2, int *child1, int *child2)
-{
-    int index1 = randomInt(0, vertexCount - 2);
-    int index2 = randomInt(index1 + 1, vertexCount - 1);
-
-    // sekcja dopasowania
-    copySection(parent2, child1, index1, index2);
-    copySection(parent1, child2, index1, index2);
-
-    // uzupełnienie sekcji poza sekcją dopasowania
-    fillMissingSection(parent1, child1, index1, index2);
-    fillMissingSection(parent2, child2, index1, index2);
-}
-
-bool GeneticAlgorithm::sectionContains(int value, int *path, int index1, int index2)
-{
-    for (int i = index1; i <= index2; ++i)
-    {
-        if (path[i] == value)
-        {
-            return true;
-        }
-    }
-    return false;
+    return min + rng() % (max - min + 1);
 }
 
 double GeneticAlgorithm::randomDouble()
 {
-    return (double)rand() / RAND_MAX;
+    return (double)rng() / rng.max();
 }
 
 void GeneticAlgorithm::executeMutations()
 {
+    PROFILE_PHASE(profile, PHASE_MUTATION);
     for (int i = 0; i < params.populationCount; ++i)
     {
-        if (params.mutationProbability > randomDouble())
+        if (mutationProbability > randomDouble())
         {
-            int index1 = randomInt(0, vertexCount - 2);
-            int index2 = randomInt(index1 + 1, vertexCount - 1);
             Individual *individual = population[i];
-            inversionMutation(individual, index1, index2);
+            if (params.mutation == "or_opt")
+            {
+                orOptMutation(individual);
+            }
+            else
+            {
+                int index1 = randomInt(0, vertexCount - 2);
+                int index2 = randomInt(index1 + 1, vertexCount - 1);
+                inversionMutation(individual, index1, index2);
+            }
         }
     }
 }
 
+void GeneticAlgorithm::orOptMutation(Individual *individual)
+{
+    individual->pathWeight += OrOpt::mutate(graph, individual->path, vertexCount, rng);
+}
+
 void GeneticAlgorithm::inversionMutation(Individual *individual, int index1, int index2)
 {
     int *path = individual->path;
     std::reverse(path + index1, path + index2 + 1);
+    PROFILE_PHASE(profile, PHASE_EVALUATION);
     individual->updatePathWeight();
+    countEvaluations(1);
 }
 
 bool GeneticAlgorithm::pathIsValid(int *path)
 {
-    int *pathCopy = new int[vertexCount];
-    copyPath(path, pathCopy);
-    std::sort(pathCopy, pathCopy + vertexCount);
-    auto pos = std::adjacent_find(pathCopy, pathCopy + vertexCount);
-    delete[] pathCopy;
-    return pos == pathCopy + vertexCount;
+    // Every vertex exactly once
+    std::fill(visited.begin(), visited.end(), 0);
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        if (path[i] < 0 || path[i] >= vertexCount || visited[path[i]])
+        {
+            return false;
+        }
+        visited[path[i]] = 1;
+    }
+    return true;
 }
 
 float GeneticAlgorithm::getError(int pathWeight)
 {
-    const int optimum = graph->getOptimum();
-    return (pathWeight - optimum) / (float)optimum;
+    // Relative to the lower bound when the optimum is unknown
+    const int reference = graph->isOptimumKnown() || lowerBound == NULL ? graph->getOptimum() : lowerBound->get();
+    return (pathWeight - reference) / (float)(reference - graph->weightOffset);
 }
 
 float GeneticAlgorithm::getPrd(int pathWeight)
@@ -301,36 +788,93 @@ float GeneticAlgorithm::getPrd(int pathWeight)
     return 100.0 * getError(pathWeight);
 }
 
+int GeneticAlgorithm::getBestWeight()
+{
+    return fittestIndividual->getPathWeight();
+}
+
 Path GeneticAlgorithm::getResult()
 {
     int *bestPath = fittestIndividual->path;
     int bestPathWeight = fittestIndividual->getPathWeight();
     float prd = getPrd(bestPathWeight);
-    return Path(bestPath, vertexCount, bestPathWeight, prd);
+    Path path(bestPath, vertexCount, bestPathWeight, prd);
+    path.restartCount = restartCount;
+    path.profile = profile;
+    return path;
+}
+
+unsigned long long GeneticAlgorithm::getEvaluationCount()
+{
+    return evaluationCount;
+}
+
+const PhaseProfile &GeneticAlgorithm::getProfile()
+{
+    return profile;
+}
+
+void GeneticAlgorithm::openPerfCounters()
+{
+    if (!params.perfCounters)
+    {
+        return;
+    }
+    if (perfCounters.open())
+    {
+        profile.attachCounters(&perfCounters);
+    }
+    else
+    {
+        LOG_WARN("ga", "Hardware performance counters are unavailable (%s).", perfCounters.getError().c_str());
+    }
+}
+
+void GeneticAlgorithm::countEvaluations(unsigned long long count)
+{
+    evaluationCount += count;
+    profile.countEvaluations(count);
+}
+
+unsigned long GeneticAlgorithm::getInitializationTimeNs()
+{
+    return initializationTimeNs;
+}
+
+float GeneticAlgorithm::getInitialPrd()
+{
+    return getPrd(initialBestWeight);
+}
+
+void GeneticAlgorithm::setStopFlag(std::atomic<bool> *stopFlag)
+{
+    this->stopFlag = stopFlag;
 }
 
 bool GeneticAlgorithm::executionTimeLimit()
 {
-    printf("elapsed: %lu ms\n", timer.getElapsedMs());
-    return timer.getElapsedMs() > params.maxExecutionTimeMs;
+    return deadline.isReached();
 }
 
-// Printing functions
+// Printing functions (debug dumps written to the standard output after the log records logged so far)
 
 void GeneticAlgorithm::printCurrentPopulation()
 {
+    Logger::flush();
     printf("Curr population: ");
     printPopulation(population, params.populationCount);
 }
 
 void GeneticAlgorithm::printNextPopulation()
 {
+    Logger::flush();
     printf("Next population: ");
     printPopulation(population, params.populationCount);
 }
 
 void GeneticAlgorithm::printPopulation(Individual **population, int populationSize)
 {
+    Logger::flush();
     printf("[");
     for (int i = 0; i < populationSize; ++i)
     {
@@ -342,6 +886,7 @@ void GeneticAlgorithm::printPopulation(Individual **population, int populationSi
 
 void GeneticAlgorithm::printPopulationWeights(Individual **population, int populationSize)
 {
+    Logger::flush();
     printf("[");
     for (int i = 0; i < populationSize; ++i)
     {
@@ -353,6 +898,7 @@ void GeneticAlgorithm::printPopulationWeights(Individual **population, int popul
 
 void GeneticAlgorithm::printArray(int *arr, int size)
 {
+    Logger::flush();
     for (int i = 0; i < size; ++i)
     {
         printf("%i ", arr[i]);
@@ -362,11 +908,12 @@ void GeneticAlgorithm::printArray(int *arr, int size)
 
 void GeneticAlgorithm::printCurrentPopulationWeights()
 {
+    Logger::flush();
     printf("Curr population weights: ");
     printPopulationWeights(population, params.populationCount);
 }
 
-void GeneticAlgorithm::printBestPrd()
+void GeneticAlgorithm::printProgress()
 {
     if (fittestIndividual == NULL)
     {
@@ -374,5 +921,6 @@ void GeneticAlgorithm::printBestPrd()
     }
     int bestPathWeight = fittestIndividual->getPathWeight();
     float prd = getPrd(bestPathWeight);
-    printf("prd: %.4f\n", prd);
+    LOG_EVENT(LEVEL_INFO, "ga", "progress", {"generation", (double)generation}, {"elapsed_ms", (double)timer.getElapsedMs()},
+              {"best_weight", (double)bestPathWeight}, {"prd", prd});
 }
@@ -1,6 +1,8 @@
 #include "GraphMatrix.hpp"
+#include "Logger.hpp"
 #include <iostream>
 #include <vector>
+#include <algorithm>
 
 GraphMatrix::GraphMatrix(int size)
 {
@@ -13,8 +15,30 @@ GraphMatrix::GraphMatrix(int size)
     }
 }
 
+GraphMatrix::GraphMatrix(const GraphMatrix &other)
+{
+    this->size = other.size;
+    this->optimumIsKnown = other.optimumIsKnown;
+    this->directed = other.directed;
+    this->optimum = other.optimum;
+    this->weightOffset = other.weightOffset;
+    this->originalVertexCount = other.originalVertexCount;
+    this->coordinatesX = other.coordinatesX;
+    this->coordinatesY = other.coordinatesY;
+
+    matrix = new int *[size];
+
+    for (int i = 0; i < size; ++i)
+    {
+        matrix[i] = new int[size];
+        std::copy(other.matrix[i], other.matrix[i] + size, matrix[i]);
+    }
+}
+
 void GraphMatrix::display()
 {
+    // Written directly after the log records logged so far
+    Logger::flush();
     printf("   |");
     for (int i = 0; i < this->size; ++i)
     {
@@ -52,9 +76,14 @@ int GraphMatrix::getVertexCount()
     return this->size;
 }
 
-std::vector<int> GraphMatrix::getAdj(int v)
+int GraphMatrix::getOriginalVertexCount()
+{
+    return originalVertexCount > 0 ? originalVertexCount : size;
+}
+
+void GraphMatrix::getAdj(int v, std::vector<int> &adj)
 {
-    std::vector<int> adj;
+    adj.clear();
 
     for (int i = 0; i < this->size; ++i)
     {
@@ -63,7 +92,6 @@ std::vector<int> GraphMatrix::getAdj(int v)
             adj.push_back(i);
         }
     }
-    return adj;
 }
 
 int GraphMatrix::getWeight(int u, int v)
@@ -71,6 +99,21 @@ int GraphMatrix::getWeight(int u, int v)
     return matrix[u][v];
 }
 
+bool GraphMatrix::isSymmetric()
+{
+    for (int i = 0; i < this->size; ++i)
+    {
+        for (int j = i + 1; j < this->size; ++j)
+        {
+            if (matrix[i][j] != matrix[j][i])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 GraphMatrix::~GraphMatrix()
 {
     for (int i = 0; i < size; ++i)
@@ -95,3 +138,8 @@ bool GraphMatrix::isOptimumKnown()
 {
     return this->optimumIsKnown;
 }
+
+bool GraphMatrix::hasCoordinates()
+{
+    return (int)coordinatesX.size() == size && (int)coordinatesY.size() == size;
+}
@@ -0,0 +1,219 @@
+#include "HeldKarp.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+HeldKarp::HeldKarp(GraphMatrix *graph, int threadCount)
+{
+    this->graph = graph;
+    this->vertexCount = graph->getVertexCount();
+    this->setSize = std::max(0, vertexCount - 1);
+    this->threadCount = threadCount > 0 ? threadCount : std::max(1, (int)std::thread::hardware_concurrency());
+
+    incomingWeight.resize(vertexCount * vertexCount);
+    for (int from = 0; from < vertexCount; ++from)
+    {
+        for (int to = 0; to < vertexCount; ++to)
+        {
+            incomingWeight[to * vertexCount + from] = graph->getWeight(from, to);
+        }
+    }
+
+    binomial.assign(setSize + 1, std::vector<unsigned long long>(setSize + 1, 0));
+    for (int i = 0; i <= setSize; ++i)
+    {
+        binomial[i][0] = 1;
+        for (int k = 1; k <= i; ++k)
+        {
+            binomial[i][k] = binomial[i - 1][k - 1] + (k < i ? binomial[i - 1][k] : 0);
+        }
+    }
+
+    // Layer k holds C(setSize, k) subsets with k last vertices each
+    unsigned long long largestLayer = 0;
+    layerOffset.assign(setSize + 2, 0);
+    for (int k = 1; k <= setSize; ++k)
+    {
+        const unsigned long long layerSize = binomial[setSize][k] * k;
+        layerOffset[k + 1] = layerOffset[k] + layerSize;
+        largestLayer = std::max(largestLayer, layerSize);
+    }
+    previousCost.resize(largestLayer);
+    cost.resize(largestLayer);
+    predecessor.resize(layerOffset[setSize + 1]);
+}
+
+unsigned long long HeldKarp::rank(uint32_t subset)
+{
+    unsigned long long r = 0;
+    int i = 1;
+    for (int b = 0; b < setSize; ++b)
+    {
+        if (subset & (1u << b))
+        {
+            r += binomial[b][i++];
+        }
+    }
+    return r;
+}
+
+uint32_t HeldKarp::unrank(unsigned long long r, int k)
+{
+    uint32_t subset = 0;
+    int b = setSize - 1;
+    for (int i = k; i > 0; --i)
+    {
+        // The largest b with C(b, i) <= r is the i-th smallest element
+        while (binomial[b][i] > r)
+        {
+            b--;
+        }
+        r -= binomial[b][i];
+        subset |= 1u << b;
+        b--;
+    }
+    return subset;
+}
+
+void HeldKarp::solveLayer(int k, unsigned long long first, unsigned long long last)
+{
+    int vertices[32];
+    // Rank of the subset without its i-th element is low[i] + high[i]
+    unsigned long long low[32];
+    unsigned long long high[32];
+    uint8_t *layerPredecessor = predecessor.data() + layerOffset[k];
+
+    uint32_t subset = unrank(first, k);
+    for (unsigned long long r = first; r < last; ++r)
+    {
+        int i = 0;
+        for (uint32_t rest = subset; rest != 0; rest &= rest - 1)
+        {
+            vertices[i++] = __builtin_ctz(rest);
+        }
+
+        low[0] = 0;
+        for (i = 1; i < k; ++i)
+        {
+            low[i] = low[i - 1] + binomial[vertices[i - 1]][i];
+        }
+        high[k - 1] = 0;
+        for (i = k - 1; i > 0; --i)
+        {
+            high[i - 1] = high[i] + binomial[vertices[i]][i];
+        }
+
+        for (i = 0; i < k; ++i)
+        {
+            const int *weightTo = incomingWeight.data() + (vertices[i] + 1) * vertexCount;
+            const int *previous = previousCost.data() + (low[i] + high[i]) * (k - 1);
+
+            // Elements after the i-th one are one position earlier in the subset without it
+            int best = INT_MAX;
+            int bestFrom = 0;
+            for (int q = 0; q < k - 1; ++q)
+            {
+                const int from = vertices[q < i ? q : q + 1] + 1;
+                const int c = previous[q] + weightTo[from];
+                if (c < best)
+                {
+                    best = c;
+                    bestFrom = from;
+                }
+            }
+            cost[r * k + i] = best;
+            layerPredecessor[r * k + i] = bestFrom;
+        }
+
+        // Next subset of k elements in colex order (Gosper's hack)
+        const uint32_t lowest = subset & -subset;
+        const uint32_t ripple = subset + lowest;
+        subset = (((ripple ^ subset) >> 2) / lowest) | ripple;
+    }
+}
+
+Path HeldKarp::solveTSP()
+{
+    if (setSize == 0)
+    {
+        return Path(std::vector<int>(vertexCount, 0), 0, getPrd(0));
+    }
+
+    for (int b = 0; b < setSize; ++b)
+    {
+        cost[b] = graph->getWeight(0, b + 1);
+        predecessor[layerOffset[1] + b] = 0;
+    }
+
+    for (int k = 2; k <= setSize; ++k)
+    {
+        std::swap(previousCost, cost);
+
+        const unsigned long long subsetCount = binomial[setSize][k];
+        // Small layers are not worth starting threads
+        const unsigned long long work = subsetCount * k * k;
+        const int layerThreadCount = work < (1 << 16) ? 1 : (int)std::min<unsigned long long>(threadCount, subsetCount);
+
+        if (layerThreadCount == 1)
+        {
+            solveLayer(k, 0, subsetCount);
+            continue;
+        }
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < layerThreadCount; ++t)
+        {
+            const unsigned long long first = subsetCount * t / layerThreadCount;
+            const unsigned long long last = subsetCount * (t + 1) / layerThreadCount;
+            threads.emplace_back(&HeldKarp::solveLayer, this, k, first, last);
+        }
+        for (std::thread &thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    // The last layer holds only the set of all vertices
+    int bestWeight = INT_MAX;
+    int bestLast = 1;
+    for (int i = 0; i < setSize; ++i)
+    {
+        const int weight = cost[i] + graph->getWeight(i + 1, 0);
+        if (weight < bestWeight)
+        {
+            bestWeight = weight;
+            bestLast = i + 1;
+        }
+    }
+
+    return Path(reconstructPath(bestLast), bestWeight, getPrd(bestWeight));
+}
+
+std::vector<int> HeldKarp::reconstructPath(int last)
+{
+    std::vector<int> path(vertexCount);
+    uint32_t subset = (1u << setSize) - 1;
+
+    for (int k = setSize; k > 0; --k)
+    {
+        path[k] = last;
+        // Index of the last vertex among the elements of the subset
+        const int index = __builtin_popcount(subset & ((1u << (last - 1)) - 1));
+        const int previous = predecessor[layerOffset[k] + rank(subset) * k + index];
+        subset &= ~(1u << (last - 1));
+        last = previous;
+    }
+    path[0] = 0;
+    return path;
+}
+
+float HeldKarp::getPrd(int pathWeight)
+{
+    // The tour is optimal
+    if (!graph->isOptimumKnown())
+        return 0.0;
+
+    const int optimum = graph->getOptimum();
+    return 100.0 * (pathWeight - optimum) / (float)optimum;
+}
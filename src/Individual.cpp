@@ -15,15 +15,26 @@ Individual::Individual(int vertexCount, GraphMatrix *graph)
     this->path = new int[vertexCount];
 }
 
+Individual::Individual(int vertexCount, GraphMatrix *graph, int *pathBuffer)
+{
+    this->graph = graph;
+    this->vertexCount = vertexCount;
+    this->path = pathBuffer;
+    this->ownsPath = false;
+}
+
 Individual::~Individual()
 {
-    delete[] this->path;
+    if (ownsPath)
+    {
+        delete[] this->path;
+    }
 }
 
-void Individual::setRandomPath()
+void Individual::setRandomPath(std::mt19937 &rng)
 {
     std::iota(path, path + vertexCount, 0);
-    std::random_shuffle(path + 1, path + vertexCount);
+    std::shuffle(path + 1, path + vertexCount, rng);
 }
 
 void Individual::printPath()
@@ -0,0 +1,231 @@
+#include "IslandModel.hpp"
+#include "Logger.hpp"
+
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+#include "GeneticAlgorithm.hpp"
+#include "Numa.hpp"
+#include "Timer.hpp"
+
+IslandModel::IslandModel(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound)
+{
+    this->graph = graph;
+    this->params = params;
+    this->lowerBound = lowerBound;
+}
+
+IslandModel::~IslandModel()
+{
+    deleteReplicas();
+}
+
+void IslandModel::createReplicas()
+{
+    const int nodeCount = Numa::getNodeCount();
+    replicas.assign(nodeCount, NULL);
+
+    std::vector<std::thread> threads;
+    for (int node = 0; node < nodeCount; ++node)
+    {
+        threads.emplace_back([this, node]()
+                             {
+            const std::vector<int> cpus = Numa::getNodeCpus(node);
+            if (!cpus.empty())
+            {
+                Numa::pinCurrentThread(cpus[0]);
+            }
+            replicas[node] = new GraphMatrix(*graph); });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void IslandModel::deleteReplicas()
+{
+    for (GraphMatrix *replica : replicas)
+    {
+        delete replica;
+    }
+    replicas.clear();
+}
+
+Path IslandModel::solveTSP()
+{
+    const int nodeCount = Numa::getNodeCount();
+
+    std::vector<Numa::NodeCounters> countersBefore(nodeCount);
+    for (int node = 0; node < nodeCount; ++node)
+    {
+        countersBefore[node] = Numa::readNodeCounters(node);
+    }
+
+    Timer timer;
+    timer.start();
+
+    std::vector<unsigned long long> evaluations(params.threadCount, 0);
+    std::vector<int> islandNodes(params.threadCount, 0);
+
+    std::vector<Path> results = params.numaAware
+                                    ? runNumaAware(evaluations, islandNodes)
+                                    : runNaive(evaluations, islandNodes);
+
+    const double elapsedS = timer.getElapsedNs() / 1e9;
+
+    nodeStatistics.assign(nodeCount, NodeStatistics());
+    for (int node = 0; node < nodeCount; ++node)
+    {
+        const Numa::NodeCounters countersAfter = Numa::readNodeCounters(node);
+        nodeStatistics[node].node = node;
+        nodeStatistics[node].localAllocations = countersAfter.localNode - countersBefore[node].localNode;
+        nodeStatistics[node].remoteAllocations = countersAfter.otherNode - countersBefore[node].otherNode;
+    }
+    for (int i = 0; i < params.threadCount; ++i)
+    {
+        NodeStatistics &stats = nodeStatistics[islandNodes[i]];
+        stats.islandCount++;
+        stats.evaluations += evaluations[i];
+    }
+    const double bytesPerEvaluation = (double)graph->getVertexCount() * sizeof(int);
+    for (NodeStatistics &stats : nodeStatistics)
+    {
+        stats.matrixBandwidthMBs = elapsedS > 0 ? stats.evaluations * bytesPerEvaluation / elapsedS / 1e6 : 0.0;
+    }
+
+    deleteReplicas();
+
+    Path best = *std::min_element(results.begin(), results.end(), [](const Path &a, const Path &b)
+                                  { return a.weight < b.weight; });
+    // Restarts and phases of all islands
+    best.restartCount = 0;
+    best.profile = PhaseProfile();
+    for (const Path &result : results)
+    {
+        best.restartCount += result.restartCount;
+        best.profile.add(result.profile);
+    }
+    return best;
+}
+
+std::vector<Path> IslandModel::runNumaAware(std::vector<unsigned long long> &evaluations, std::vector<int> &islandNodes)
+{
+    if (params.replicateGraph)
+    {
+        createReplicas();
+    }
+
+    const std::vector<int> cpus = Numa::assignCpus(params.threadCount, islandNodes);
+
+    std::vector<unsigned int> seeds(params.threadCount);
+    for (int i = 0; i < params.threadCount; ++i)
+    {
+        seeds[i] = params.seed != 0 ? params.seed + i : rand();
+    }
+
+    std::vector<Path> results(params.threadCount);
+    std::vector<std::thread> threads;
+    std::atomic<bool> stopFlag(false);
+
+    for (int i = 0; i < params.threadCount; ++i)
+    {
+        threads.emplace_back([this, i, &cpus, &seeds, &islandNodes, &results, &evaluations, &stopFlag]()
+                             {
+            Numa::pinCurrentThread(cpus[i]);
+
+            AlgorithmParams islandParams = params;
+            islandParams.seed = seeds[i];
+            // Islands already run in parallel
+            islandParams.initializationThreadCount = 1;
+            // Only the first island saves its adaptation and convergence traces
+            if (i > 0)
+            {
+                islandParams.adaptiveTrace = "";
+                islandParams.traceFile = "";
+            }
+
+            GraphMatrix *islandGraph = replicas.empty() ? graph : replicas[islandNodes[i]];
+
+            // Constructed by the pinned thread, so the population arena is first touched on the local node
+            GeneticAlgorithm alg(islandGraph, islandParams, lowerBound);
+            alg.setStopFlag(&stopFlag);
+            results[i] = alg.solveTSP();
+            evaluations[i] = alg.getEvaluationCount(); });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    return results;
+}
+
+std::vector<Path> IslandModel::runNaive(std::vector<unsigned long long> &evaluations, std::vector<int> &islandNodes)
+{
+    // Memory of all islands is touched by the calling thread
+    const int callerNode = Numa::getCurrentNode();
+
+    std::vector<GeneticAlgorithm *> islands(params.threadCount);
+    for (int i = 0; i < params.threadCount; ++i)
+    {
+        AlgorithmParams islandParams = params;
+        islandParams.seed = params.seed != 0 ? params.seed + i : rand();
+        // Islands already run in parallel
+        islandParams.initializationThreadCount = 1;
+        // Only the first island saves its adaptation and convergence traces
+        if (i > 0)
+        {
+            islandParams.adaptiveTrace = "";
+            islandParams.traceFile = "";
+        }
+        islands[i] = new GeneticAlgorithm(graph, islandParams, lowerBound);
+    }
+
+    std::vector<Path> results(params.threadCount);
+    std::vector<std::thread> threads;
+    std::atomic<bool> stopFlag(false);
+
+    for (GeneticAlgorithm *island : islands)
+    {
+        island->setStopFlag(&stopFlag);
+    }
+
+    for (int i = 0; i < params.threadCount; ++i)
+    {
+        threads.emplace_back([i, &islands, &results]()
+                             { results[i] = islands[i]->solveTSP(); });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (int i = 0; i < params.threadCount; ++i)
+    {
+        islandNodes[i] = callerNode;
+        evaluations[i] = islands[i]->getEvaluationCount();
+        delete islands[i];
+    }
+    return results;
+}
+
+std::vector<NodeStatistics> IslandModel::getNodeStatistics()
+{
+    return nodeStatistics;
+}
+
+void IslandModel::printNodeStatistics()
+{
+    LOG_INFO("islands", "node, islands, evaluations, estimated matrix bandwidth [MB/s], local allocs, remote allocs");
+    for (const NodeStatistics &stats : nodeStatistics)
+    {
+        LOG_INFO("islands", "%i, %i, %llu, %.2f, %lld, %lld",
+                 stats.node,
+                 stats.islandCount,
+                 stats.evaluations,
+                 stats.matrixBandwidthMBs,
+                 stats.localAllocations,
+                 stats.remoteAllocations);
+    }
+}
@@ -0,0 +1,254 @@
+#include "IteratedLocalSearch.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "GeneticAlgorithm.hpp"
+#include "FileUtils.hpp"
+
+const int IteratedLocalSearch::MAX_KICK_SEGMENT;
+
+IteratedLocalSearch::IteratedLocalSearch(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound)
+{
+    this->params = params;
+    this->graph = graph;
+    this->lowerBound = lowerBound;
+    this->vertexCount = graph->getVertexCount();
+    this->params.minError = GeneticAlgorithm::getMinError(graph->getOriginalVertexCount());
+
+    this->rng.seed(params.seed != 0 ? params.seed : rand());
+
+    this->candidates = LowerBound::createCandidateList(graph, params, lowerBound);
+    this->lk = new LinKernighan(graph, candidates, params.lkDepth, params.twoLevelListMinSize);
+}
+
+IteratedLocalSearch::~IteratedLocalSearch()
+{
+    delete lk;
+    delete candidates;
+}
+
+Path IteratedLocalSearch::solveTSP()
+{
+    start();
+    while (!step())
+    {
+    }
+    return finish();
+}
+
+void IteratedLocalSearch::start()
+{
+    timer.start();
+    profile.startMemory();
+    deadline.start(params.maxExecutionTimeMs);
+    convergenceTrace.reset(params.traceFile.empty() ? 0 : params.traceCapacity);
+    if (params.perfCounters)
+    {
+        if (perfCounters.open())
+        {
+            profile.attachCounters(&perfCounters);
+        }
+        else
+        {
+            LOG_WARN("ils", "Hardware performance counters are unavailable (%s).", perfCounters.getError().c_str());
+        }
+    }
+
+    {
+        PROFILE_PHASE(profile, PHASE_INITIALIZATION);
+        bestPath.resize(vertexCount);
+        std::iota(bestPath.begin(), bestPath.end(), 0);
+        std::shuffle(bestPath.begin() + 1, bestPath.end(), rng);
+
+        lk->load(bestPath.data());
+        bestWeight = calculateWeight(bestPath.data()) - lk->improve();
+        lk->store(bestPath.data());
+    }
+    recordTraceSample();
+}
+
+bool IteratedLocalSearch::step()
+{
+    if (endConditionIsMet())
+        return true;
+
+    int weight = bestWeight;
+    {
+        PROFILE_PHASE(profile, PHASE_MUTATION);
+        weight += kick();
+    }
+    {
+        PROFILE_PHASE(profile, PHASE_LOCAL_SEARCH);
+        weight -= lk->improve();
+    }
+    kickCount++;
+    if (params.progressInterval > 0 && kickCount % params.progressInterval == 0)
+    {
+        LOG_EVENT(LEVEL_INFO, "ils", "progress", {"kick", (double)kickCount}, {"elapsed_ms", (double)timer.getElapsedMs()},
+                  {"best_weight", (double)std::min(weight, bestWeight)}, {"prd", getPrd(std::min(weight, bestWeight))});
+    }
+
+    if (weight < bestWeight)
+    {
+        bestWeight = weight;
+        recordTraceSample();
+    }
+    else
+    {
+        if (weight > bestWeight)
+        {
+            // Continue from the best tour (the next kick activates its endpoints)
+            lk->undoKick();
+        }
+        if (kickCount % params.traceInterval == 0)
+        {
+            recordTraceSample();
+        }
+    }
+    return false;
+}
+
+void IteratedLocalSearch::attachThread()
+{
+    profile.attachThread();
+}
+
+void IteratedLocalSearch::detachThread()
+{
+    profile.detachThread();
+}
+
+Path IteratedLocalSearch::finish()
+{
+    if (profile.perfCounters != NULL)
+    {
+        profile.detachCounters();
+        perfCounters.close();
+        profile.printEvents();
+    }
+
+    profile.finishMemory();
+    lk->store(bestPath.data());
+    Path path(bestPath, bestWeight, getPrd(bestWeight));
+    path.profile = profile;
+    path.profile.generations = kickCount;
+
+    if (convergenceTrace.isEnabled())
+    {
+        recordTraceSample();
+        FileUtils::writeConvergenceTrace(params.traceFile, convergenceTrace.getSamples(), convergenceTrace.getDroppedCount());
+    }
+    path.profile.runTimeNs = timer.getElapsedNs();
+    return path;
+}
+
+void IteratedLocalSearch::recordTraceSample()
+{
+    if (!convergenceTrace.isEnabled())
+    {
+        return;
+    }
+
+    // A single tour, its weight is also the mean
+    TraceSample sample;
+    sample.timeNs = timer.getElapsedNs();
+    sample.generation = kickCount;
+    sample.bestWeight = bestWeight - graph->weightOffset;
+    sample.meanWeight = sample.bestWeight;
+    sample.diversity = 1.0;
+    convergenceTrace.record(sample);
+}
+
+int IteratedLocalSearch::kick()
+{
+    if (vertexCount < 8)
+        return 0;
+
+    const int maxLength = std::max(1, std::min(MAX_KICK_SEGMENT, (vertexCount - 2) / 3));
+    const int length1 = 1 + rng() % maxLength;
+    const int length2 = 1 + rng() % maxLength;
+
+    Tour &tour = lk->getTour();
+
+    // Tour: ... first..last after1..after ... becomes ... after1..after first..last ...
+    const int first = rng() % vertexCount;
+    int last = first;
+    for (int i = 1; i < length1; ++i)
+    {
+        last = tour.next(last);
+    }
+    int after = tour.next(last);
+    for (int i = 1; i < length2; ++i)
+    {
+        after = tour.next(after);
+    }
+
+    return lk->kick(first, last, after);
+}
+
+bool IteratedLocalSearch::endConditionIsMet()
+{
+    if (deadline.isReached())
+    {
+        LOG_INFO("ils", "Reached the execution time limit");
+        return true;
+    }
+
+    if (getPrd(bestWeight) <= params.minError)
+    {
+        LOG_INFO("ils", "Reached minimum error: %.4f.", params.minError);
+        return true;
+    }
+
+    if (lowerBound != NULL && lowerBound->getGap(bestWeight) <= params.maxGap)
+    {
+        LOG_INFO("ils", "Reached the lower bound gap: %.4f.", params.maxGap);
+        return true;
+    }
+
+    return false;
+}
+
+int IteratedLocalSearch::calculateWeight(int *path)
+{
+    int sum = 0;
+    for (int i = 0; i < vertexCount - 1; ++i)
+    {
+        sum += graph->getWeight(path[i], path[i + 1]);
+    }
+    return sum + graph->getWeight(path[vertexCount - 1], path[0]);
+}
+
+float IteratedLocalSearch::getError(int pathWeight)
+{
+    // Relative to the lower bound when the optimum is unknown
+    const int reference = graph->isOptimumKnown() || lowerBound == NULL ? graph->getOptimum() : lowerBound->get();
+    return (pathWeight - reference) / (float)(reference - graph->weightOffset);
+}
+
+float IteratedLocalSearch::getPrd(int pathWeight)
+{
+    return 100.0 * getError(pathWeight);
+}
+
+int IteratedLocalSearch::getBestWeight()
+{
+    return bestWeight;
+}
+
+unsigned long long IteratedLocalSearch::getKickCount()
+{
+    return kickCount;
+}
+
+double IteratedLocalSearch::getAverageStepNs()
+{
+    return lk->getAverageStepNs();
+}
+
+unsigned long long IteratedLocalSearch::getImprovingMoves()
+{
+    return lk->getImprovingMoves();
+}
@@ -0,0 +1,245 @@
+#include "LinKernighan.hpp"
+
+#include "Timer.hpp"
+
+const int LinKernighan::BREADTH[] = {5, 3, 2};
+const int LinKernighan::BREADTH_LEVELS = 3;
+
+LinKernighan::LinKernighan(GraphMatrix *graph, CandidateList *candidates, int maxDepth, int twoLevelListMinSize)
+{
+    this->graph = graph;
+    this->candidates = candidates;
+    this->vertexCount = graph->getVertexCount();
+    this->maxDepth = maxDepth;
+
+    this->tour = Tour::create(vertexCount, twoLevelListMinSize);
+    this->queue = VertexQueue(vertexCount);
+    this->moveStack.reserve(4 * maxDepth);
+    this->journal.reserve(4 * maxDepth);
+}
+
+LinKernighan::~LinKernighan()
+{
+    delete tour;
+}
+
+void LinKernighan::make2OptMove(int t1, int t2, int t3, int t4)
+{
+    if (tour->next(t1) == t2)
+        tour->reverse(t2, t4);
+    else
+        tour->reverse(t1, t3);
+}
+
+void LinKernighan::undoMoves(int stackSize)
+{
+    while ((int)moveStack.size() > stackSize)
+    {
+        const int t4 = moveStack.back();
+        moveStack.pop_back();
+        const int t3 = moveStack.back();
+        moveStack.pop_back();
+        const int t2 = moveStack.back();
+        moveStack.pop_back();
+        const int t1 = moveStack.back();
+        moveStack.pop_back();
+
+        // Edges (t2, t3), (t4, t1) are replaced back with (t1, t2), (t3, t4)
+        make2OptMove(t1, t4, t3, t2);
+    }
+}
+
+int LinKernighan::step(int level, int t1, int t2, int gain)
+{
+    const int breadth = level < BREADTH_LEVELS ? BREADTH[level] : 1;
+    const int *t2Candidates = candidates->get(t2);
+    const int candidateCount = candidates->getSize();
+
+    int tried = 0;
+    for (int i = 0; i < candidateCount && tried < breadth; ++i)
+    {
+        const int t3 = t2Candidates[i];
+        const int g1 = gain - graph->getWeight(t2, t3);
+
+        // Positive gain criterion (candidates are sorted)
+        if (g1 <= 0)
+            break;
+
+        if (t3 == t1 || t3 == tour->next(t2) || t3 == tour->prev(t2))
+            continue;
+
+        // Undoing a move may have reversed the orientation of the tour, so it is checked for every candidate
+        const bool forward = tour->next(t1) == t2;
+        const int t4 = forward ? tour->prev(t3) : tour->next(t3);
+        if (t4 == t1 || t4 == t2)
+            continue;
+
+        tried++;
+
+        const int g2 = g1 + graph->getWeight(t3, t4);
+        const int closeGain = g2 - graph->getWeight(t4, t1);
+
+        const int stackSize = moveStack.size();
+        make2OptMove(t1, t2, t3, t4);
+        moveStack.push_back(t1);
+        moveStack.push_back(t2);
+        moveStack.push_back(t3);
+        moveStack.push_back(t4);
+
+        if (closeGain > 0)
+            return closeGain;
+
+        if (level + 1 < maxDepth)
+        {
+            const int deeperGain = step(level + 1, t1, t4, g2);
+            if (deeperGain > 0)
+                return deeperGain;
+        }
+
+        undoMoves(stackSize);
+    }
+    return 0;
+}
+
+int LinKernighan::improveVertex(int t1)
+{
+    for (int direction = 0; direction < 2; ++direction)
+    {
+        const int t2 = direction == 0 ? tour->next(t1) : tour->prev(t1);
+
+        moveStack.clear();
+        const int gain = step(0, t1, t2, graph->getWeight(t1, t2));
+        if (gain > 0)
+        {
+            for (int v : moveStack)
+            {
+                queue.push(v);
+            }
+            if (kickFirst >= 0)
+                journal.insert(journal.end(), moveStack.begin(), moveStack.end());
+            moveStack.clear();
+            return gain;
+        }
+    }
+    return 0;
+}
+
+int LinKernighan::improveActive(int budget)
+{
+    Timer timer;
+    timer.start();
+
+    int totalGain = 0;
+    int moves = 0;
+
+    while (!queue.isEmpty())
+    {
+        const int t1 = queue.pop();
+        const int gain = improveVertex(t1);
+        if (gain > 0)
+        {
+            totalGain += gain;
+            moves++;
+            if (budget > 0 && moves >= budget)
+                break;
+        }
+    }
+
+    improvingMoves += moves;
+    improvementTimeNs += timer.getElapsedNs();
+    return totalGain;
+}
+
+int LinKernighan::optimize(int *path, int budget)
+{
+    if (vertexCount < 8)
+        return 0;
+
+    load(path);
+    const int gain = improveActive(budget);
+    tour->store(path);
+    return gain;
+}
+
+void LinKernighan::load(int *path)
+{
+    tour->load(path);
+    kickFirst = -1;
+    journal.clear();
+
+    queue.clear();
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        queue.push(path[i]);
+    }
+}
+
+void LinKernighan::store(int *path)
+{
+    tour->store(path);
+}
+
+int LinKernighan::kick(int first, int last, int after)
+{
+    const int p = tour->prev(first);
+    const int n = tour->next(last);
+    const int b = tour->next(after);
+
+    const int delta = graph->getWeight(p, n) + graph->getWeight(after, first) + graph->getWeight(last, b) - graph->getWeight(p, first) - graph->getWeight(last, n) - graph->getWeight(after, b);
+
+    tour->moveSegment(first, last, after);
+    kickFirst = first;
+    kickLast = last;
+    kickAfter = after;
+    kickPrev = p;
+    kickNext = n;
+    journal.clear();
+
+    for (int v : {p, n, first, last, after, b})
+    {
+        queue.push(v);
+    }
+    return delta;
+}
+
+int LinKernighan::improve()
+{
+    if (vertexCount < 8)
+        return 0;
+
+    return improveActive(0);
+}
+
+void LinKernighan::undoKick()
+{
+    if (kickFirst < 0)
+        return;
+
+    // The 2-opt moves are undone in reverse order (undoMoves works on the move stack)
+    moveStack.swap(journal);
+    undoMoves(0);
+    moveStack.swap(journal);
+
+    // Undoing the moves leaves the tour after the kick, possibly in the opposite direction
+    if (tour->next(kickAfter) == kickFirst)
+        tour->moveSegment(kickFirst, kickLast, kickPrev);
+    else
+        tour->moveSegment(kickLast, kickFirst, kickNext);
+    kickFirst = -1;
+    queue.clear();
+}
+
+Tour &LinKernighan::getTour()
+{
+    return *tour;
+}
+
+unsigned long long LinKernighan::getImprovingMoves()
+{
+    return improvingMoves;
+}
+
+double LinKernighan::getAverageStepNs()
+{
+    return improvingMoves > 0 ? (double)improvementTimeNs / improvingMoves : 0.0;
+}
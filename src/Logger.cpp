@@ -0,0 +1,366 @@
+#include "Logger.hpp"
+
+#include <cstdio>
+#include <cstdarg>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
+
+std::atomic<int> Logger::activeLevel(LEVEL_INFO);
+const int Logger::DRAIN_PERIOD_MS;
+
+struct LogRecord
+{
+    long long timeNs;
+    LogLevel level;
+    int threadId;
+    const char *component;
+    int fieldCount;
+    LogField fields[Logger::MAX_FIELDS];
+    char message[Logger::MESSAGE_SIZE];
+};
+
+// Ring buffer of one thread, only the thread writes records and only the draining thread reads them
+struct LogBuffer
+{
+    LogRecord records[Logger::BUFFER_CAPACITY];
+    std::atomic<unsigned long long> head{0};
+    std::atomic<unsigned long long> tail{0};
+    std::atomic<unsigned long long> dropped{0};
+    // Set when the thread exits, the buffer is deleted after it is drained
+    std::atomic<bool> retired{false};
+    int threadId = 0;
+};
+
+// Buffer of the current thread, created when it logs for the first time
+struct ThreadBuffer
+{
+    LogBuffer *buffer = NULL;
+
+    ~ThreadBuffer()
+    {
+        if (buffer != NULL)
+            buffer->retired.store(true, std::memory_order_release);
+    }
+};
+
+static const char *LEVEL_NAMES[] = {"debug", "info", "warn", "error", "off"};
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static std::atomic<int> nextThreadId(0);
+static thread_local int threadId = nextThreadId++;
+static thread_local ThreadBuffer threadBuffer;
+
+static std::atomic<bool> running(false);
+static bool json = false;
+static FILE *output = stdout;
+
+// Locked when a thread logs for the first time and while the buffers are drained
+static std::mutex buffersMutex;
+static std::vector<LogBuffer *> buffers;
+// Serializes draining and synchronous writes
+static std::mutex outputMutex;
+static std::vector<LogRecord> batch;
+
+static std::thread drainThread;
+static std::mutex wakeMutex;
+static std::condition_variable wake;
+static bool stopRequested = false;
+static bool exitHandlerRegistered = false;
+
+static void fillRecord(LogRecord &record, LogLevel level, const char *component, std::initializer_list<LogField> fields,
+                       const char *format, va_list args)
+{
+    record.timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+    record.level = level;
+    record.threadId = threadId;
+    record.component = component;
+    record.fieldCount = 0;
+    for (const LogField &field : fields)
+    {
+        if (record.fieldCount == Logger::MAX_FIELDS)
+            break;
+        record.fields[record.fieldCount++] = field;
+    }
+
+    int length = vsnprintf(record.message, Logger::MESSAGE_SIZE, format, args);
+    length = std::min(std::max(length, 0), Logger::MESSAGE_SIZE - 1);
+    // Every record is a line
+    while (length > 0 && record.message[length - 1] == '\n')
+    {
+        record.message[--length] = '\0';
+    }
+}
+
+static void writeNumber(FILE *file, double value)
+{
+    if (!std::isfinite(value))
+        fputs(json ? "null" : (std::isnan(value) ? "nan" : "inf"), file);
+    else if (value == std::floor(value) && std::fabs(value) < 1e15)
+        fprintf(file, "%.0f", value);
+    else
+        fprintf(file, "%.6g", value);
+}
+
+static void writeJsonString(FILE *file, const char *text)
+{
+    fputc('"', file);
+    for (const char *c = text; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            fprintf(file, "\\%c", *c);
+        else if (*c == '\n')
+            fputs("\\n", file);
+        else if ((unsigned char)*c < 0x20)
+            fprintf(file, "\\u%04x", *c);
+        else
+            fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+static void writeRecord(FILE *file, const LogRecord &record)
+{
+    if (json)
+    {
+        // Blank lines separating the human readable output are dropped
+        const char *message = record.message;
+        while (*message == '\n')
+        {
+            message++;
+        }
+        fprintf(file, "{\"time_ms\":%.3f,\"level\":\"%s\",\"thread\":%i,\"component\":", record.timeNs / 1e6,
+                LEVEL_NAMES[record.level], record.threadId);
+        writeJsonString(file, record.component);
+        fputs(",\"msg\":", file);
+        writeJsonString(file, message);
+        for (int i = 0; i < record.fieldCount; ++i)
+        {
+            fputc(',', file);
+            writeJsonString(file, record.fields[i].key);
+            fputc(':', file);
+            writeNumber(file, record.fields[i].value);
+        }
+        fputs("}\n", file);
+        return;
+    }
+
+    if (record.level == LEVEL_DEBUG)
+        fputs("debug: ", file);
+    else if (record.level == LEVEL_WARN)
+        fputs("warning: ", file);
+    else if (record.level == LEVEL_ERROR)
+        fputs("error: ", file);
+    fputs(record.message, file);
+    for (int i = 0; i < record.fieldCount; ++i)
+    {
+        fprintf(file, " %s=", record.fields[i].key);
+        writeNumber(file, record.fields[i].value);
+    }
+    fputc('\n', file);
+}
+
+// Writes the records of every buffer in the order of their time and deletes the buffers of exited threads
+static void drain()
+{
+    std::lock_guard<std::mutex> outputLock(outputMutex);
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto it = buffers.begin(); it != buffers.end();)
+        {
+            LogBuffer *buffer = *it;
+            // Read before the head, so that every record of a retired buffer is drained
+            const bool retired = buffer->retired.load(std::memory_order_acquire);
+            const unsigned long long tail = buffer->tail.load(std::memory_order_relaxed);
+            const unsigned long long head = buffer->head.load(std::memory_order_acquire);
+            for (unsigned long long i = tail; i < head; ++i)
+            {
+                batch.push_back(buffer->records[i % Logger::BUFFER_CAPACITY]);
+            }
+            buffer->tail.store(head, std::memory_order_release);
+
+            const unsigned long long dropped = buffer->dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0)
+            {
+                LogRecord record;
+                record.timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+                record.level = LEVEL_WARN;
+                record.threadId = buffer->threadId;
+                record.component = "log";
+                record.fieldCount = 0;
+                snprintf(record.message, Logger::MESSAGE_SIZE, "%llu debug records dropped (full buffer)", dropped);
+                batch.push_back(record);
+            }
+
+            if (retired)
+            {
+                delete buffer;
+                it = buffers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    if (batch.empty())
+        return;
+
+    std::stable_sort(batch.begin(), batch.end(), [](const LogRecord &a, const LogRecord &b)
+                     { return a.timeNs < b.timeNs; });
+    for (const LogRecord &record : batch)
+    {
+        writeRecord(output, record);
+    }
+    fflush(output);
+    batch.clear();
+}
+
+static void drainLoop()
+{
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    while (!stopRequested)
+    {
+        lock.unlock();
+        drain();
+        lock.lock();
+        wake.wait_for(lock, std::chrono::milliseconds(Logger::DRAIN_PERIOD_MS), []()
+                      { return stopRequested; });
+    }
+}
+
+static void stopAtExit()
+{
+    Logger::stop();
+}
+
+bool Logger::start(LogLevel level, std::string format, std::string filePath)
+{
+    stop();
+    setLevel(level);
+    json = format == "json";
+
+    bool opened = true;
+    if (!filePath.empty())
+    {
+        FILE *file = fopen(filePath.c_str(), "a");
+        if (file != NULL)
+            output = file;
+        else
+            opened = false;
+    }
+
+    stopRequested = false;
+    running.store(true);
+    drainThread = std::thread(drainLoop);
+    if (!exitHandlerRegistered)
+    {
+        // Records logged before exit() are written
+        atexit(stopAtExit);
+        exitHandlerRegistered = true;
+    }
+    return opened;
+}
+
+void Logger::stop()
+{
+    if (!running.exchange(false))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopRequested = true;
+    }
+    wake.notify_all();
+    drainThread.join();
+    drain();
+
+    if (output != stdout)
+    {
+        fclose(output);
+        output = stdout;
+    }
+}
+
+void Logger::flush()
+{
+    if (running.load())
+    {
+        drain();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(outputMutex);
+    fflush(output);
+}
+
+void Logger::setLevel(LogLevel level)
+{
+    activeLevel.store(level, std::memory_order_relaxed);
+}
+
+bool Logger::parseLevel(std::string name, LogLevel &level)
+{
+    for (int i = LEVEL_DEBUG; i <= LEVEL_OFF; ++i)
+    {
+        if (name == LEVEL_NAMES[i])
+        {
+            level = (LogLevel)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Logger::write(LogLevel level, const char *component, std::initializer_list<LogField> fields, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    if (running.load(std::memory_order_relaxed))
+    {
+        if (threadBuffer.buffer == NULL)
+        {
+            LogBuffer *buffer = new LogBuffer();
+            buffer->threadId = threadId;
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            buffers.push_back(buffer);
+            threadBuffer.buffer = buffer;
+        }
+        LogBuffer *buffer = threadBuffer.buffer;
+
+        const unsigned long long head = buffer->head.load(std::memory_order_relaxed);
+        bool full = head - buffer->tail.load(std::memory_order_acquire) == BUFFER_CAPACITY;
+        if (full && level == LEVEL_DEBUG)
+        {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            va_end(args);
+            return;
+        }
+        while (full && running.load(std::memory_order_relaxed))
+        {
+            std::this_thread::yield();
+            full = head - buffer->tail.load(std::memory_order_acquire) == BUFFER_CAPACITY;
+        }
+
+        if (!full)
+        {
+            fillRecord(buffer->records[head % BUFFER_CAPACITY], level, component, fields, format, args);
+            buffer->head.store(head + 1, std::memory_order_release);
+            va_end(args);
+            return;
+        }
+    }
+
+    // No background thread
+    LogRecord record;
+    fillRecord(record, level, component, fields, format, args);
+    va_end(args);
+    std::lock_guard<std::mutex> lock(outputMutex);
+    writeRecord(output, record);
+}
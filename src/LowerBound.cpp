@@ -0,0 +1,352 @@
+#include "LowerBound.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <limits>
+#include <climits>
+
+LowerBound::LowerBound(GraphMatrix *graph, int maxIterations) : bound(0), stopRequested(false), finished(false)
+{
+    this->graph = graph;
+    this->vertexCount = graph->getVertexCount();
+    this->maxIterations = maxIterations;
+    this->firstSpecial = 0;
+    this->secondSpecial = 0;
+}
+
+void LowerBound::compute()
+{
+    if (vertexCount < 3)
+    {
+        // The only tour
+        bound.store(vertexCount == 2 ? graph->getWeight(0, 1) + graph->getWeight(1, 0) : 0);
+    }
+    else if (graph->directed)
+    {
+        assignment();
+    }
+    else
+    {
+        subgradient();
+    }
+    finished.store(true);
+}
+
+void LowerBound::stop()
+{
+    stopRequested.store(true, std::memory_order_relaxed);
+}
+
+int LowerBound::get()
+{
+    return bound.load(std::memory_order_relaxed);
+}
+
+bool LowerBound::isFinished()
+{
+    return finished.load();
+}
+
+float LowerBound::getGap(int weight)
+{
+    // Relative to the weights of the original instance of a transformed graph
+    const int lowerBound = get() - graph->weightOffset;
+    if (lowerBound <= 0)
+    {
+        return std::numeric_limits<float>::infinity();
+    }
+    return 100.0 * (weight - graph->weightOffset - lowerBound) / (float)lowerBound;
+}
+
+double LowerBound::penalizedWeight(const std::vector<double> &pi, int u, int v)
+{
+    return graph->getWeight(u, v) + pi[u] + pi[v];
+}
+
+double LowerBound::minimumOneTree(const std::vector<double> &pi)
+{
+    key.assign(vertexCount, std::numeric_limits<double>::infinity());
+    inTree.assign(vertexCount, false);
+    parent.assign(vertexCount, -1);
+    degree.assign(vertexCount, 0);
+    order.clear();
+
+    // Prim's algorithm on the dense graph of vertices 1..n-1
+    double weight = 0.0;
+    key[1] = 0.0;
+    for (int step = 1; step < vertexCount; ++step)
+    {
+        int v = -1;
+        for (int u = 1; u < vertexCount; ++u)
+        {
+            if (!inTree[u] && (v < 0 || key[u] < key[v]))
+                v = u;
+        }
+
+        inTree[v] = true;
+        order.push_back(v);
+        weight += key[v];
+        if (parent[v] >= 0)
+        {
+            degree[v]++;
+            degree[parent[v]]++;
+        }
+
+        for (int u = 1; u < vertexCount; ++u)
+        {
+            if (inTree[u])
+                continue;
+            const double w = penalizedWeight(pi, v, u);
+            if (w < key[u])
+            {
+                key[u] = w;
+                parent[u] = v;
+            }
+        }
+    }
+
+    // Two shortest edges of vertex 0
+    firstSpecial = secondSpecial = -1;
+    for (int u = 1; u < vertexCount; ++u)
+    {
+        const double w = penalizedWeight(pi, 0, u);
+        if (firstSpecial < 0 || w < penalizedWeight(pi, 0, firstSpecial))
+        {
+            secondSpecial = firstSpecial;
+            firstSpecial = u;
+        }
+        else if (secondSpecial < 0 || w < penalizedWeight(pi, 0, secondSpecial))
+        {
+            secondSpecial = u;
+        }
+    }
+    weight += penalizedWeight(pi, 0, firstSpecial) + penalizedWeight(pi, 0, secondSpecial);
+    degree[0] = 2;
+    degree[firstSpecial]++;
+    degree[secondSpecial]++;
+
+    return weight - 2.0 * std::accumulate(pi.begin(), pi.end(), 0.0);
+}
+
+int LowerBound::nearestNeighborWeight()
+{
+    std::vector<char> visited(vertexCount, false);
+    int current = 0;
+    int weight = 0;
+    visited[0] = true;
+    for (int step = 1; step < vertexCount; ++step)
+    {
+        int next = -1;
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            if (!visited[v] && (next < 0 || graph->getWeight(current, v) < graph->getWeight(current, next)))
+                next = v;
+        }
+        weight += graph->getWeight(current, next);
+        visited[next] = true;
+        current = next;
+    }
+    return weight + graph->getWeight(current, 0);
+}
+
+void LowerBound::subgradient()
+{
+    const int upperBound = nearestNeighborWeight();
+
+    std::vector<double> pi(vertexCount, 0.0);
+    std::vector<int> previousDegree(vertexCount, 2);
+    penalties = pi;
+
+    double lambda = 2.0;
+    double bestWeight = -std::numeric_limits<double>::infinity();
+    int iterationsWithoutImprovement = 0;
+
+    for (int iteration = 0; iteration < maxIterations && !stopRequested.load(std::memory_order_relaxed); ++iteration)
+    {
+        const double weight = minimumOneTree(pi);
+
+        if (weight > bestWeight + 1e-9)
+        {
+            bestWeight = weight;
+            penalties = pi;
+            iterationsWithoutImprovement = 0;
+            // Tour weights are integers
+            const int rounded = std::min(upperBound, (int)std::ceil(weight - 1e-6));
+            if (rounded > bound.load())
+                bound.store(rounded);
+        }
+        else if (++iterationsWithoutImprovement >= STEP_PERIOD)
+        {
+            lambda /= 2;
+            iterationsWithoutImprovement = 0;
+            if (lambda < MIN_STEP_FACTOR)
+                break;
+        }
+
+        int norm = 0;
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            norm += (degree[v] - 2) * (degree[v] - 2);
+        }
+        // Every vertex has degree 2, so the 1-tree is an optimal tour
+        if (norm == 0 || bound.load() >= upperBound)
+            break;
+
+        // Polyak step towards the nearest neighbor tour weight, the direction is smoothed with the previous one
+        const double step = lambda * (upperBound - weight) / norm;
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            pi[v] += step * (0.7 * (degree[v] - 2) + 0.3 * (previousDegree[v] - 2));
+        }
+        previousDegree = degree;
+    }
+}
+
+void LowerBound::assignment()
+{
+    // Hungarian algorithm with potentials, rows and columns numbered from 1 (0 is the artificial column)
+    const long long infinity = std::numeric_limits<long long>::max() / 4;
+    const int n = vertexCount;
+    std::vector<long long> u(n + 1, 0), v(n + 1, 0), minSlack(n + 1);
+    std::vector<int> match(n + 1, 0), way(n + 1, 0);
+    std::vector<char> used(n + 1);
+
+    for (int row = 1; row <= n; ++row)
+    {
+        if (stopRequested.load(std::memory_order_relaxed))
+            return;
+
+        match[0] = row;
+        int column = 0;
+        std::fill(minSlack.begin(), minSlack.end(), infinity);
+        std::fill(used.begin(), used.end(), false);
+        do
+        {
+            used[column] = true;
+            const int i = match[column];
+            long long delta = infinity;
+            int nextColumn = 0;
+            for (int j = 1; j <= n; ++j)
+            {
+                if (used[j])
+                    continue;
+                // Loops are not allowed
+                const long long cost = i == j ? infinity : graph->getWeight(i - 1, j - 1);
+                const long long slack = cost - u[i] - v[j];
+                if (slack < minSlack[j])
+                {
+                    minSlack[j] = slack;
+                    way[j] = column;
+                }
+                if (minSlack[j] < delta)
+                {
+                    delta = minSlack[j];
+                    nextColumn = j;
+                }
+            }
+            for (int j = 0; j <= n; ++j)
+            {
+                if (used[j])
+                {
+                    u[match[j]] += delta;
+                    v[j] -= delta;
+                }
+                else
+                {
+                    minSlack[j] -= delta;
+                }
+            }
+            column = nextColumn;
+        } while (match[column] != 0);
+
+        do
+        {
+            const int previous = way[column];
+            match[column] = match[previous];
+            column = previous;
+        } while (column != 0);
+    }
+
+    int weight = 0;
+    for (int j = 1; j <= n; ++j)
+    {
+        weight += graph->getWeight(match[j] - 1, j - 1);
+    }
+    bound.store(weight);
+}
+
+CandidateList *LowerBound::createAlphaCandidates(int k)
+{
+    const std::vector<double> pi = penalties.empty() ? std::vector<double>(vertexCount, 0.0) : penalties;
+    minimumOneTree(pi);
+
+    const int size = std::max(0, std::min(k, vertexCount - 1));
+    std::vector<int> neighbors((size_t)vertexCount * size);
+
+    std::vector<double> parentWeight(vertexCount, 0.0);
+    for (int v : order)
+    {
+        if (parent[v] >= 0)
+            parentWeight[v] = penalizedWeight(pi, v, parent[v]);
+    }
+    const double secondSpecialWeight = penalizedWeight(pi, 0, secondSpecial);
+
+    // beta[j] - weight of the heaviest edge on the tree path from i to j
+    std::vector<double> beta(vertexCount);
+    std::vector<double> alpha(vertexCount);
+    std::vector<int> onPath(vertexCount, -1);
+    std::vector<int> others(vertexCount);
+
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        // Edge (0, j) replaces the longer of the two edges of vertex 0
+        const auto specialAlpha = [&](int j)
+        {
+            return j == firstSpecial || j == secondSpecial ? 0.0 : penalizedWeight(pi, 0, j) - secondSpecialWeight;
+        };
+
+        if (i == 0)
+        {
+            for (int j = 1; j < vertexCount; ++j)
+                alpha[j] = specialAlpha(j);
+        }
+        else
+        {
+            // Path from i to the root, then every other vertex after its parent (vertices are in the order of Prim's algorithm)
+            beta[i] = -std::numeric_limits<double>::infinity();
+            onPath[i] = i;
+            for (int v = i; parent[v] >= 0; v = parent[v])
+            {
+                beta[parent[v]] = std::max(beta[v], parentWeight[v]);
+                onPath[parent[v]] = i;
+            }
+            for (int v : order)
+            {
+                if (onPath[v] != i)
+                    beta[v] = std::max(beta[parent[v]], parentWeight[v]);
+            }
+
+            alpha[0] = specialAlpha(i);
+            for (int j = 1; j < vertexCount; ++j)
+                alpha[j] = penalizedWeight(pi, i, j) - beta[j];
+        }
+
+        std::iota(others.begin(), others.end(), 0);
+        std::swap(others[i], others[vertexCount - 1]);
+        std::partial_sort(others.begin(), others.begin() + size, others.end() - 1, [&](int a, int b)
+                          { return alpha[a] != alpha[b] ? alpha[a] < alpha[b] : graph->getWeight(i, a) < graph->getWeight(i, b); });
+        std::copy(others.begin(), others.begin() + size, neighbors.begin() + (size_t)i * size);
+    }
+
+    return new CandidateList(vertexCount, size, neighbors);
+}
+
+CandidateList *LowerBound::createCandidateList(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound)
+{
+    if (params.candidates == "alpha" && lowerBound != NULL && lowerBound->isFinished() && !graph->directed)
+    {
+        return lowerBound->createAlphaCandidates(params.candidateListSize);
+    }
+    return new CandidateList(graph, params.candidateListSize);
+}
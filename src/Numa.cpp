@@ -0,0 +1,141 @@
+#include "Numa.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+static const std::string NODE_DIR = "/sys/devices/system/node/node";
+
+int Numa::getNodeCount()
+{
+    int nodeCount = 0;
+    while (std::ifstream(NODE_DIR + std::to_string(nodeCount) + "/cpulist"))
+    {
+        nodeCount++;
+    }
+    return nodeCount > 0 ? nodeCount : 1;
+}
+
+std::vector<int> Numa::getNodeCpus(int node)
+{
+    std::vector<int> cpus;
+    std::ifstream fin(NODE_DIR + std::to_string(node) + "/cpulist");
+
+    std::string list;
+    if (fin && std::getline(fin, list))
+    {
+        // Format: "0-3,8-11"
+        std::stringstream ss(list);
+        std::string range;
+        while (std::getline(ss, range, ','))
+        {
+            if (range.empty())
+                continue;
+
+            const size_t dash = range.find('-');
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+
+    if (cpus.empty() && node == 0)
+    {
+        const int cpuCount = std::max(1u, std::thread::hardware_concurrency());
+        for (int cpu = 0; cpu < cpuCount; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+std::vector<int> Numa::assignCpus(int workerCount, std::vector<int> &workerNodes)
+{
+    const int nodeCount = getNodeCount();
+
+    std::vector<std::vector<int>> nodeCpus(nodeCount);
+    for (int node = 0; node < nodeCount; ++node)
+    {
+        nodeCpus[node] = getNodeCpus(node);
+    }
+
+    std::vector<int> cpus(workerCount);
+    std::vector<int> usedPerNode(nodeCount, 0);
+    workerNodes.resize(workerCount);
+
+    for (int i = 0; i < workerCount; ++i)
+    {
+        // Skip nodes without cpus (memory only nodes)
+        int node = i % nodeCount;
+        for (int tries = 0; tries < nodeCount && nodeCpus[node].empty(); ++tries)
+        {
+            node = (node + 1) % nodeCount;
+        }
+
+        const std::vector<int> &available = nodeCpus[node];
+        workerNodes[i] = node;
+        cpus[i] = available.empty() ? -1 : available[usedPerNode[node]++ % available.size()];
+    }
+    return cpus;
+}
+
+int Numa::getCurrentNode()
+{
+#ifdef __linux__
+    const int cpu = sched_getcpu();
+    const int nodeCount = getNodeCount();
+    for (int node = 0; node < nodeCount; ++node)
+    {
+        const std::vector<int> cpus = getNodeCpus(node);
+        if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end())
+            return node;
+    }
+#endif
+    return 0;
+}
+
+bool Numa::pinCurrentThread(int cpu)
+{
+#ifdef __linux__
+    if (cpu < 0)
+        return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+Numa::NodeCounters Numa::readNodeCounters(int node)
+{
+    NodeCounters counters;
+    std::ifstream fin(NODE_DIR + std::to_string(node) + "/numastat");
+
+    std::string key;
+    long long value;
+    while (fin >> key >> value)
+    {
+        if (key == "numa_hit")
+            counters.numaHit = value;
+        else if (key == "numa_miss")
+            counters.numaMiss = value;
+        else if (key == "local_node")
+            counters.localNode = value;
+        else if (key == "other_node")
+            counters.otherNode = value;
+    }
+    return counters;
+}
@@ -0,0 +1,174 @@
+#include "OrOpt.hpp"
+
+#include <algorithm>
+
+OrOpt::OrOpt(GraphMatrix *graph, CandidateList *outCandidates, CandidateList *inCandidates, int twoLevelListMinSize)
+{
+    this->graph = graph;
+    this->outCandidates = outCandidates;
+    this->inCandidates = inCandidates;
+    this->vertexCount = graph->getVertexCount();
+
+    this->tour = Tour::create(vertexCount, twoLevelListMinSize);
+    this->queue = VertexQueue(vertexCount);
+}
+
+OrOpt::~OrOpt()
+{
+    delete tour;
+}
+
+int OrOpt::optimize(int *path, int budget)
+{
+    if (vertexCount < MAX_SEGMENT_LENGTH + 3)
+        return 0;
+
+    tour->load(path);
+
+    queue.clear();
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        queue.push(path[i]);
+    }
+
+    int totalGain = 0;
+    int moves = 0;
+
+    while (!queue.isEmpty())
+    {
+        const int s1 = queue.pop();
+        const int gain = improveVertex(s1);
+        if (gain > 0)
+        {
+            totalGain += gain;
+            moves++;
+            if (budget > 0 && moves >= budget)
+                break;
+        }
+    }
+
+    tour->store(path);
+    return totalGain;
+}
+
+int OrOpt::improveVertex(int s1)
+{
+    const int p = tour->prev(s1);
+    int s2 = s1;
+    int segment[MAX_SEGMENT_LENGTH];
+
+    for (int length = 1; length <= MAX_SEGMENT_LENGTH; ++length)
+    {
+        if (length > 1)
+            s2 = tour->next(s2);
+        segment[length - 1] = s2;
+
+        const int n = tour->next(s2);
+        if (n == p)
+            break;
+
+        // Gain of removing the segment and closing the gap
+        const int removeGain = graph->getWeight(p, s1) + graph->getWeight(s2, n) - graph->getWeight(p, n);
+        if (removeGain <= 0)
+            continue;
+
+        auto inSegment = [&segment, length](int v)
+        {
+            for (int k = 0; k < length; ++k)
+            {
+                if (segment[k] == v)
+                    return true;
+            }
+            return false;
+        };
+
+        // New edge (a, s1): a from the candidates of s1, b = next(a)
+        const int *aCandidates = inCandidates->get(s1);
+        for (int i = 0; i < inCandidates->getSize(); ++i)
+        {
+            const int a = aCandidates[i];
+            const int g1 = removeGain - graph->getWeight(a, s1);
+            if (g1 <= 0)
+                break;
+            if (a == p || inSegment(a))
+                continue;
+
+            const int b = tour->next(a);
+            const int gain = g1 + graph->getWeight(a, b) - graph->getWeight(s2, b);
+            if (gain > 0)
+            {
+                applyMove(s1, s2, a, b);
+                queue.push(p);
+                queue.push(n);
+                return gain;
+            }
+        }
+
+        // New edge (s2, b): b from the candidates of s2, a = prev(b)
+        const int *bCandidates = outCandidates->get(s2);
+        for (int i = 0; i < outCandidates->getSize(); ++i)
+        {
+            const int b = bCandidates[i];
+            const int g1 = removeGain - graph->getWeight(s2, b);
+            if (g1 <= 0)
+                break;
+            if (b == n || inSegment(b))
+                continue;
+
+            const int a = tour->prev(b);
+            const int gain = g1 + graph->getWeight(a, b) - graph->getWeight(a, s1);
+            if (gain > 0)
+            {
+                applyMove(s1, s2, a, b);
+                queue.push(p);
+                queue.push(n);
+                return gain;
+            }
+        }
+    }
+    return 0;
+}
+
+void OrOpt::applyMove(int s1, int s2, int a, int b)
+{
+    tour->moveSegment(s1, s2, a);
+
+    queue.push(s1);
+    queue.push(s2);
+    queue.push(a);
+    queue.push(b);
+}
+
+int OrOpt::mutate(GraphMatrix *graph, int *path, int vertexCount, std::mt19937 &rng)
+{
+    if (vertexCount < MAX_SEGMENT_LENGTH + 3)
+        return 0;
+
+    const int length = 1 + rng() % MAX_SEGMENT_LENGTH;
+    const int start = rng() % (vertexCount - length + 1);
+    const int end = start + length - 1;
+
+    // Insertion point: the segment is placed after vertex at index `after` (outside the segment and not its predecessor)
+    int after;
+    do
+    {
+        after = rng() % vertexCount;
+    } while ((after >= start - 1 && after <= end) || (start == 0 && after == vertexCount - 1));
+
+    auto at = [path, vertexCount](int i)
+    { return path[(i + vertexCount) % vertexCount]; };
+
+    const int p = at(start - 1);
+    const int n = at(end + 1);
+    const int a = path[after];
+    const int b = at(after + 1);
+
+    const int delta = graph->getWeight(p, n) + graph->getWeight(a, path[start]) + graph->getWeight(path[end], b) - graph->getWeight(p, path[start]) - graph->getWeight(path[end], n) - graph->getWeight(a, b);
+
+    if (after > end)
+        std::rotate(path + start, path + end + 1, path + after + 1);
+    else
+        std::rotate(path + after + 1, path + start, path + end + 1);
+
+    return delta;
+}
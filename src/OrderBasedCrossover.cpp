@@ -0,0 +1,36 @@
+#include "OrderBasedCrossover.hpp"
+
+OrderBasedCrossover::OrderBasedCrossover(GraphMatrix *graph) : Crossover(graph)
+{
+    selected.reserve(vertexCount);
+}
+
+int OrderBasedCrossover::crossover(const int *parent1, int /*parent1Weight*/, const int *parent2, int *child, std::mt19937 &rng)
+{
+    clearMarks();
+    selected.clear();
+
+    // Every position of parent2 is chosen with probability 1/2, one random number gives 32 positions
+    unsigned int bits = 0;
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        if (i % 32 == 0)
+        {
+            bits = rng();
+        }
+        if (bits & 1)
+        {
+            selected.push_back(parent2[i]);
+            mark[parent2[i]] = stamp;
+        }
+        bits >>= 1;
+    }
+
+    int next = 0;
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        child[i] = mark[parent1[i]] == stamp ? selected[next++] : parent1[i];
+    }
+
+    return evaluate(child);
+}
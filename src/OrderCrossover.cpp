@@ -0,0 +1,32 @@
+#include "OrderCrossover.hpp"
+
+OrderCrossover::OrderCrossover(GraphMatrix *graph) : Crossover(graph)
+{
+}
+
+int OrderCrossover::crossover(const int *parent1, int /*parent1Weight*/, const int *parent2, int *child, std::mt19937 &rng)
+{
+    const int index1 = randomInt(rng, 0, vertexCount - 2);
+    const int index2 = randomInt(rng, index1 + 1, vertexCount - 1);
+
+    clearMarks();
+    for (int i = index1; i <= index2; ++i)
+    {
+        child[i] = parent1[i];
+        mark[parent1[i]] = stamp;
+    }
+
+    // Fill the positions after the section (wrapping around) in the order of parent2
+    int childIndex = (index2 + 1) % vertexCount;
+    for (int i = 1; i <= vertexCount; ++i)
+    {
+        const int v = parent2[(index2 + i) % vertexCount];
+        if (mark[v] != stamp)
+        {
+            child[childIndex] = v;
+            childIndex = (childIndex + 1) % vertexCount;
+        }
+    }
+
+    return evaluate(child);
+}
@@ -0,0 +1,36 @@
+#include "PartiallyMappedCrossover.hpp"
+
+PartiallyMappedCrossover::PartiallyMappedCrossover(GraphMatrix *graph) : Crossover(graph)
+{
+    position.resize(vertexCount);
+}
+
+int PartiallyMappedCrossover::crossover(const int *parent1, int /*parent1Weight*/, const int *parent2, int *child, std::mt19937 &rng)
+{
+    const int index1 = randomInt(rng, 0, vertexCount - 2);
+    const int index2 = randomInt(rng, index1 + 1, vertexCount - 1);
+
+    clearMarks();
+    for (int i = index1; i <= index2; ++i)
+    {
+        child[i] = parent1[i];
+        mark[parent1[i]] = stamp;
+        position[parent1[i]] = i;
+    }
+
+    // Mapping chains of different positions never share a position of the section, so this is O(n)
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        if (i >= index1 && i <= index2)
+            continue;
+
+        int v = parent2[i];
+        while (mark[v] == stamp)
+        {
+            v = parent2[position[v]];
+        }
+        child[i] = v;
+    }
+
+    return evaluate(child);
+}
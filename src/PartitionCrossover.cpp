@@ -0,0 +1,149 @@
+#include "PartitionCrossover.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+PartitionCrossover::PartitionCrossover(GraphMatrix *graph) : Crossover(graph)
+{
+    next1.resize(vertexCount);
+    prev1.resize(vertexCount);
+    next2.resize(vertexCount);
+    prev2.resize(vertexCount);
+    root.resize(vertexCount);
+    component.resize(vertexCount);
+    partner.resize(vertexCount);
+    feasible.resize(vertexCount);
+    weight1.resize(vertexCount);
+    weight2.resize(vertexCount);
+}
+
+int PartitionCrossover::find(int v)
+{
+    while (root[v] != v)
+    {
+        root[v] = root[root[v]];
+        v = root[v];
+    }
+    return v;
+}
+
+void PartitionCrossover::unite(int u, int v)
+{
+    root[find(u)] = find(v);
+}
+
+bool PartitionCrossover::inParent2(int u, int v)
+{
+    return next2[u] == v || prev2[u] == v;
+}
+
+void PartitionCrossover::scanPaths(const int *parent, bool first)
+{
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        const int c = component[parent[i]];
+        // A path starts after a common edge entering the component
+        if (c < 0 || component[parent[(i + vertexCount - 1) % vertexCount]] == c)
+            continue;
+
+        int j = i;
+        int weight = 0;
+        while (component[parent[(j + 1) % vertexCount]] == c)
+        {
+            weight += graph->getWeight(parent[j % vertexCount], parent[(j + 1) % vertexCount]);
+            j++;
+        }
+        const int start = parent[i];
+        const int end = parent[j % vertexCount];
+
+        if (first)
+        {
+            partner[start] = end;
+            partner[end] = start;
+            weight1[c] += weight;
+        }
+        else
+        {
+            if (partner[start] != end || partner[end] != start)
+                feasible[c] = false;
+            weight2[c] += weight;
+        }
+    }
+}
+
+int PartitionCrossover::crossover(const int *parent1, int parent1Weight, const int *parent2, int *child, std::mt19937 &/*rng*/)
+{
+    if (vertexCount < 5)
+    {
+        std::copy(parent1, parent1 + vertexCount, child);
+        return parent1Weight;
+    }
+
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        next1[parent1[i]] = parent1[(i + 1) % vertexCount];
+        prev1[parent1[i]] = parent1[(i + vertexCount - 1) % vertexCount];
+        next2[parent2[i]] = parent2[(i + 1) % vertexCount];
+        prev2[parent2[i]] = parent2[(i + vertexCount - 1) % vertexCount];
+    }
+
+    // Components of the edges of only one parent
+    std::iota(root.begin(), root.end(), 0);
+    std::fill(component.begin(), component.end(), -1);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        if (!inParent2(v, next1[v]))
+        {
+            unite(v, next1[v]);
+            component[v] = component[next1[v]] = 0;
+        }
+        const int u = next2[v];
+        if (next1[v] != u && prev1[v] != u)
+        {
+            unite(v, u);
+            component[v] = component[u] = 0;
+        }
+    }
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        if (component[v] == 0)
+        {
+            component[v] = find(v);
+            feasible[component[v]] = true;
+            weight1[component[v]] = 0;
+            weight2[component[v]] = 0;
+        }
+    }
+
+    scanPaths(parent1, true);
+    scanPaths(parent2, false);
+
+    // A component covering all vertices has no entries, it stays from the first parent
+    int weight = parent1Weight;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        const int c = component[v];
+        if (c == v && feasible[c] && weight2[c] < weight1[c])
+        {
+            weight -= weight1[c] - weight2[c];
+        }
+    }
+
+    // Walk the child: vertices of the components taken from the second parent use its neighbors
+    // (the edges leaving a component are common, so both ends agree on them)
+    int previous = -1;
+    int current = parent1[0];
+    for (int k = 0; k < vertexCount; ++k)
+    {
+        child[k] = current;
+        const int c = component[current];
+        const bool fromParent2 = c >= 0 && feasible[c] && weight2[c] < weight1[c];
+        const int a = fromParent2 ? next2[current] : next1[current];
+        const int b = fromParent2 ? prev2[current] : prev1[current];
+        const int next = a != previous ? a : b;
+        previous = current;
+        current = next;
+    }
+
+    return weight;
+}
@@ -0,0 +1,155 @@
+#include "PerfCounters.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+// Type and config of every event
+static const uint32_t EVENT_TYPES[PerfCounters::EVENT_COUNT] = {
+    PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE};
+static const uint64_t EVENT_CONFIGS[PerfCounters::EVENT_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_BRANCH_MISSES};
+#endif
+
+PerfCounters::PerfCounters()
+{
+    std::fill(position, position + EVENT_COUNT, -1);
+}
+
+PerfCounters::~PerfCounters()
+{
+    close();
+}
+
+bool PerfCounters::open()
+{
+    close();
+    error.clear();
+#ifdef __linux__
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = EVENT_TYPES[event];
+        attr.config = EVENT_CONFIGS[event];
+        // Only the leader starts disabled, the members follow it
+        attr.disabled = leader < 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // The calling thread on any cpu
+        const int fd = syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+        if (fd < 0)
+        {
+            if (error.empty())
+            {
+                error = std::string(getName((Event)event)) + ": " + strerror(errno);
+            }
+            continue;
+        }
+        if (leader < 0)
+        {
+            leader = fd;
+        }
+        fds.push_back(fd);
+        position[event] = memberCount++;
+    }
+
+    if (leader < 0)
+    {
+        return false;
+    }
+    buffer.resize(3 + memberCount);
+    ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+#else
+    error = "perf_event_open is available on Linux only";
+    return false;
+#endif
+}
+
+void PerfCounters::close()
+{
+#ifdef __linux__
+    for (int fd : fds)
+    {
+        ::close(fd);
+    }
+#endif
+    fds.clear();
+    leader = -1;
+    memberCount = 0;
+    std::fill(position, position + EVENT_COUNT, -1);
+}
+
+bool PerfCounters::isOpen()
+{
+    return leader >= 0;
+}
+
+bool PerfCounters::isAvailable(Event event)
+{
+    return position[event] >= 0;
+}
+
+bool PerfCounters::read(unsigned long long values[EVENT_COUNT])
+{
+#ifdef __linux__
+    if (leader < 0)
+    {
+        return false;
+    }
+
+    // nr, time enabled, time running, values of the members
+    const ssize_t size = buffer.size() * sizeof(uint64_t);
+    if (::read(leader, buffer.data(), size) != size)
+    {
+        error = std::string("read: ") + strerror(errno);
+        return false;
+    }
+    const uint64_t enabled = buffer[1];
+    const uint64_t running = buffer[2];
+    // The group was never on the PMU (e.g. a counter is held by the NMI watchdog), the values are not counts
+    if (running == 0 && enabled > 0)
+    {
+        error = "the event group could not be scheduled on the PMU";
+        return false;
+    }
+    const double scale = running > 0 && running < enabled ? (double)enabled / running : 1.0;
+    for (int event = 0; event < EVENT_COUNT; ++event)
+    {
+        if (position[event] >= 0)
+        {
+            values[event] = (unsigned long long)(buffer[3 + position[event]] * scale);
+        }
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string PerfCounters::getError()
+{
+    return error;
+}
+
+const char *PerfCounters::getName(Event event)
+{
+    static const char *names[EVENT_COUNT] = {"cycles", "instructions", "L1d misses", "LLC misses", "dTLB misses", "branch misses"};
+    return names[event];
+}
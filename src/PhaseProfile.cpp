@@ -0,0 +1,222 @@
+#include "PhaseProfile.hpp"
+#include "Logger.hpp"
+#include "AllocationCounter.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+PhaseProfile::PhaseProfile()
+{
+    std::fill(&events[0][0], &events[0][0] + PHASE_COUNT * PerfCounters::EVENT_COUNT, -1LL);
+}
+
+const char *PhaseProfile::getName(Phase phase)
+{
+    static const char *names[PHASE_COUNT] = {"initialization", "mutation", "evaluation", "selection",
+                                             "crossover", "local search", "succession", "restart"};
+    return names[phase];
+}
+
+void PhaseProfile::attachCounters(PerfCounters *counters)
+{
+    if (!counters->read(lastEvents))
+    {
+        LOG_WARN("profile", "Hardware performance counters cannot be read (%s), the events are not measured.", counters->getError().c_str());
+        return;
+    }
+    perfCounters = counters;
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        for (int event = 0; event < PerfCounters::EVENT_COUNT; ++event)
+        {
+            if (counters->isAvailable((PerfCounters::Event)event) && events[phase][event] < 0)
+            {
+                events[phase][event] = 0;
+            }
+        }
+    }
+}
+
+void PhaseProfile::detachCounters()
+{
+    perfCounters = NULL;
+}
+
+void PhaseProfile::chargeEvents()
+{
+    unsigned long long values[PerfCounters::EVENT_COUNT];
+    if (!perfCounters->read(values))
+    {
+        // No phase gets counts that were not measured
+        LOG_WARN("profile", "Hardware performance counters cannot be read (%s), the events are not measured.", perfCounters->getError().c_str());
+        std::fill(&events[0][0], &events[0][0] + PHASE_COUNT * PerfCounters::EVENT_COUNT, -1LL);
+        perfCounters = NULL;
+        return;
+    }
+    for (int event = 0; event < PerfCounters::EVENT_COUNT; ++event)
+    {
+        if (events[current][event] >= 0)
+        {
+            // Scaling of multiplexed counts can make them decrease slightly
+            events[current][event] += values[event] > lastEvents[event] ? values[event] - lastEvents[event] : 0;
+        }
+        lastEvents[event] = values[event];
+    }
+}
+
+void PhaseProfile::startMemory()
+{
+    allocationCount = 0;
+    allocatedByteCount = 0;
+    attachThread();
+}
+
+void PhaseProfile::finishMemory()
+{
+    detachThread();
+    AllocationCounter::getArenaUsage(arenaBytes, arenaInUseBytes);
+}
+
+void PhaseProfile::attachThread()
+{
+    startAllocations = AllocationCounter::getAllocations();
+    startAllocatedBytes = AllocationCounter::getAllocatedBytes();
+    lastAllocations = startAllocations;
+    lastAllocatedBytes = startAllocatedBytes;
+    if (perfCounters != NULL)
+    {
+        perfCounters->read(lastEvents);
+    }
+    threadAttached = true;
+}
+
+void PhaseProfile::detachThread()
+{
+    if (!threadAttached)
+        return;
+    allocationCount += AllocationCounter::getAllocations() - startAllocations;
+    allocatedByteCount += AllocationCounter::getAllocatedBytes() - startAllocatedBytes;
+    threadAttached = false;
+}
+
+void PhaseProfile::chargeAllocations()
+{
+    const unsigned long long count = AllocationCounter::getAllocations();
+    const unsigned long long bytes = AllocationCounter::getAllocatedBytes();
+    allocations[current] += count - lastAllocations;
+    allocatedBytes[current] += bytes - lastAllocatedBytes;
+    lastAllocations = count;
+    lastAllocatedBytes = bytes;
+}
+
+Phase PhaseProfile::enter(Phase phase)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (current != PHASE_COUNT)
+    {
+        timeNs[current] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - since).count();
+        chargeAllocations();
+    }
+    else
+    {
+        lastAllocations = AllocationCounter::getAllocations();
+        lastAllocatedBytes = AllocationCounter::getAllocatedBytes();
+    }
+    if (perfCounters != NULL)
+    {
+        if (current != PHASE_COUNT)
+        {
+            chargeEvents();
+        }
+        else
+        {
+            perfCounters->read(lastEvents);
+        }
+    }
+    since = now;
+    calls[phase]++;
+
+    const Phase previous = current;
+    current = phase;
+    return previous;
+}
+
+void PhaseProfile::leave(Phase previous)
+{
+    const auto now = std::chrono::steady_clock::now();
+    timeNs[current] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - since).count();
+    chargeAllocations();
+    if (perfCounters != NULL)
+    {
+        chargeEvents();
+    }
+    since = now;
+    current = previous;
+}
+
+void PhaseProfile::countEvaluations(unsigned long long count)
+{
+    if (current != PHASE_COUNT)
+    {
+        evaluations[current] += count;
+    }
+}
+
+void PhaseProfile::add(const PhaseProfile &other)
+{
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        timeNs[phase] += other.timeNs[phase];
+        calls[phase] += other.calls[phase];
+        evaluations[phase] += other.evaluations[phase];
+        allocations[phase] += other.allocations[phase];
+        allocatedBytes[phase] += other.allocatedBytes[phase];
+    }
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        for (int event = 0; event < PerfCounters::EVENT_COUNT; ++event)
+        {
+            if (other.events[phase][event] >= 0)
+            {
+                events[phase][event] = std::max(0LL, events[phase][event]) + other.events[phase][event];
+            }
+        }
+    }
+    generations += other.generations;
+    evaluationCount += other.evaluationCount;
+    runTimeNs = std::max(runTimeNs, other.runTimeNs);
+    allocationCount += other.allocationCount;
+    allocatedByteCount += other.allocatedByteCount;
+    // Process-wide values
+    peakRssKb = std::max(peakRssKb, other.peakRssKb);
+    arenaBytes = std::max(arenaBytes, other.arenaBytes);
+    arenaInUseBytes = std::max(arenaInUseBytes, other.arenaInUseBytes);
+}
+
+double PhaseProfile::getEvaluationsPerSecond() const
+{
+    return runTimeNs > 0 ? evaluationCount / (runTimeNs / 1e9) : 0.0;
+}
+
+void PhaseProfile::printEvents()
+{
+    LOG_INFO("profile", "phase, cycles, instructions, IPC, L1d misses, LLC misses, dTLB misses, branch misses (per 1000 instructions)");
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        const long long *counts = events[phase];
+        if (counts[PerfCounters::CYCLES] <= 0 && counts[PerfCounters::INSTRUCTIONS] <= 0)
+        {
+            continue;
+        }
+
+        const double instructions = counts[PerfCounters::INSTRUCTIONS];
+        const auto perThousand = [&](PerfCounters::Event event)
+        {
+            return counts[event] < 0 || instructions <= 0 ? -1.0 : 1000.0 * counts[event] / instructions;
+        };
+        LOG_INFO("profile", "%s, %lld, %lld, %.2f, %.2f, %.2f, %.2f, %.2f", getName((Phase)phase), counts[PerfCounters::CYCLES], counts[PerfCounters::INSTRUCTIONS],
+                 counts[PerfCounters::CYCLES] > 0 && instructions > 0 ? instructions / counts[PerfCounters::CYCLES] : -1.0,
+                 perThousand(PerfCounters::L1D_MISSES), perThousand(PerfCounters::LLC_MISSES), perThousand(PerfCounters::DTLB_MISSES),
+                 perThousand(PerfCounters::BRANCH_MISSES));
+    }
+}
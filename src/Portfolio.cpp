@@ -0,0 +1,260 @@
+#include "Portfolio.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <numeric>
+#include <thread>
+
+#include "Timer.hpp"
+
+Portfolio::Portfolio(GraphMatrix *graph, std::vector<AlgorithmParams> configurations, int timeLimitMs, int threadCount, LowerBound *lowerBound)
+{
+    this->graph = graph;
+    this->timeLimitMs = timeLimitMs;
+    this->threadCount = std::max(1, threadCount);
+    this->lowerBound = lowerBound;
+
+    // Every configuration runs in one thread at a time and stops only by the race (or its own end condition)
+    for (int c = 0; c < (int)configurations.size(); ++c)
+    {
+        AlgorithmParams &params = configurations[c];
+        params.threadCount = 1;
+        params.initializationThreadCount = 1;
+        params.maxExecutionTimeMs = timeLimitMs;
+        params.seed = params.seed != 0 ? params.seed + c : c + 1;
+        // Only the first configuration saves its adaptation trace
+        if (c > 0)
+            params.adaptiveTrace = "";
+        // Counters belong to a thread and the configurations move between threads
+        params.perfCounters = false;
+    }
+    this->configurations = configurations;
+}
+
+Portfolio::~Portfolio()
+{
+    for (GeneticAlgorithm *geneticAlgorithm : geneticAlgorithms)
+    {
+        delete geneticAlgorithm;
+    }
+    for (IteratedLocalSearch *localSearch : localSearches)
+    {
+        delete localSearch;
+    }
+}
+
+std::string Portfolio::describe(AlgorithmParams params)
+{
+    char description[256];
+    if (params.engine == "lin_kernighan")
+    {
+        snprintf(description, sizeof(description), "lin_kernighan candidates %i depth %i", params.candidateListSize, params.lkDepth);
+    }
+    else
+    {
+        snprintf(description, sizeof(description), "generational population %i crossover %s %.2f mutation %.2f local search %s",
+                 params.populationCount, params.crossover.c_str(), params.crossoverProbability, params.mutationProbability,
+                 params.localSearch.c_str());
+    }
+    return description;
+}
+
+bool Portfolio::runSlice(int configuration, unsigned long sliceMs)
+{
+    Timer timer;
+    timer.start();
+
+    GeneticAlgorithm *&geneticAlgorithm = geneticAlgorithms[configuration];
+    IteratedLocalSearch *&localSearch = localSearches[configuration];
+    if (geneticAlgorithm == NULL && localSearch == NULL)
+    {
+        const AlgorithmParams &params = configurations[configuration];
+        if (params.engine == "lin_kernighan" && !graph->directed)
+        {
+            localSearch = new IteratedLocalSearch(graph, params, lowerBound);
+            localSearch->start();
+        }
+        else
+        {
+            geneticAlgorithm = new GeneticAlgorithm(graph, params, lowerBound);
+            geneticAlgorithm->start();
+        }
+    }
+    // The slices of a configuration run on any thread of the pool, its profile counts the calling thread
+    else if (geneticAlgorithm != NULL)
+    {
+        geneticAlgorithm->attachThread();
+    }
+    else
+    {
+        localSearch->attachThread();
+    }
+
+    PortfolioRecord &record = records[configuration];
+    bool finished = false;
+    while (!finished && timer.getElapsedMs() < sliceMs)
+    {
+        finished = geneticAlgorithm != NULL ? geneticAlgorithm->step() : localSearch->step();
+        record.steps++;
+    }
+
+    if (geneticAlgorithm != NULL)
+        geneticAlgorithm->detachThread();
+    else
+        localSearch->detachThread();
+
+    record.rounds++;
+    record.timeMs += timer.getElapsedMs();
+    record.bestWeight = geneticAlgorithm != NULL ? geneticAlgorithm->getBestWeight() : localSearch->getBestWeight();
+    return finished;
+}
+
+void Portfolio::stopConfiguration(int configuration, std::string status)
+{
+    GeneticAlgorithm *&geneticAlgorithm = geneticAlgorithms[configuration];
+    IteratedLocalSearch *&localSearch = localSearches[configuration];
+    PortfolioRecord &record = records[configuration];
+    record.status = status;
+
+    if (geneticAlgorithm == NULL && localSearch == NULL)
+        return;
+
+    // finish() runs on the calling thread
+    if (geneticAlgorithm != NULL)
+        geneticAlgorithm->attachThread();
+    else
+        localSearch->attachThread();
+    results[configuration] = geneticAlgorithm != NULL ? geneticAlgorithm->finish() : localSearch->finish();
+    record.bestWeight = results[configuration].weight;
+    record.prd = results[configuration].prd;
+
+    delete geneticAlgorithm;
+    delete localSearch;
+    geneticAlgorithm = NULL;
+    localSearch = NULL;
+}
+
+Path Portfolio::solveTSP()
+{
+    Timer timer;
+    timer.start();
+
+    const int count = configurations.size();
+    geneticAlgorithms.assign(count, NULL);
+    localSearches.assign(count, NULL);
+    results.assign(count, Path());
+    records.assign(count, PortfolioRecord());
+    for (int c = 0; c < count; ++c)
+    {
+        records[c].configuration = c;
+        records[c].description = describe(configurations[c]);
+    }
+
+    // Halving count configurations leaves one after ceil(log2(count)) rounds, it gets the last round alone
+    int roundCount = 1;
+    while ((1 << (roundCount - 1)) < count)
+    {
+        roundCount++;
+    }
+
+    std::vector<int> alive(count);
+    std::iota(alive.begin(), alive.end(), 0);
+    const float minError = GeneticAlgorithm::getMinError(graph->getOriginalVertexCount());
+    bool targetReached = false;
+
+    for (int round = 0; round < roundCount && !alive.empty() && !targetReached; ++round)
+    {
+        const long remainingMs = timeLimitMs - (long)timer.getElapsedMs();
+        if (remainingMs <= 0)
+            break;
+
+        // The round takes its share of the remaining wall time, the configurations run in batches of slots
+        const unsigned long roundMs = remainingMs / (roundCount - round);
+        const int slots = std::min<int>(threadCount, alive.size());
+        const int batchCount = (alive.size() + slots - 1) / slots;
+        const unsigned long sliceMs = roundMs / batchCount;
+        LOG_INFO("portfolio", "Portfolio round %i: %zu configurations, %i threads, %lu ms each", round, alive.size(), slots, sliceMs);
+
+        std::vector<char> finished(count, false);
+        std::atomic<int> next(0);
+        const auto worker = [&]()
+        {
+            for (int i = next++; i < (int)alive.size(); i = next++)
+            {
+                // Slices started late (uneven slices, slow starts) end at the time limit of the race
+                const long leftMs = std::max(0L, timeLimitMs - (long)timer.getElapsedMs());
+                finished[alive[i]] = runSlice(alive[i], std::min<unsigned long>(sliceMs, leftMs));
+            }
+        };
+        if (slots == 1)
+        {
+            worker();
+        }
+        else
+        {
+            std::vector<std::thread> threads;
+            for (int t = 0; t < slots; ++t)
+            {
+                threads.emplace_back(worker);
+            }
+            for (std::thread &thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        std::vector<int> running;
+        for (int c : alive)
+        {
+            if (!finished[c])
+            {
+                running.push_back(c);
+                continue;
+            }
+            stopConfiguration(c, "finished");
+            const bool gapReached = lowerBound != NULL && lowerBound->getGap(records[c].bestWeight) <= configurations[c].maxGap;
+            targetReached |= records[c].prd <= minError || gapReached;
+        }
+        alive = running;
+
+        if (round == roundCount - 1 || targetReached)
+            break;
+
+        // Racing: the better half by the best weight goes on
+        std::stable_sort(alive.begin(), alive.end(), [&](int a, int b)
+                         { return records[a].bestWeight < records[b].bestWeight; });
+        const int keep = (alive.size() + 1) / 2;
+        for (int i = keep; i < (int)alive.size(); ++i)
+        {
+            stopConfiguration(alive[i], "eliminated");
+        }
+        alive.resize(keep);
+    }
+
+    for (int c : alive)
+    {
+        stopConfiguration(c, "survivor");
+    }
+
+    int winner = -1;
+    for (int c = 0; c < count; ++c)
+    {
+        if (records[c].rounds > 0 && (winner < 0 || records[c].bestWeight < records[winner].bestWeight))
+            winner = c;
+    }
+    if (winner < 0)
+    {
+        return Path(std::vector<int>(), INT_MAX, 0.0);
+    }
+    records[winner].winner = true;
+    LOG_INFO("portfolio", "Portfolio winner: configuration %i (%s), weight %i, prd: %.4f", winner, records[winner].description.c_str(),
+             records[winner].bestWeight, records[winner].prd);
+    return results[winner];
+}
+
+std::vector<PortfolioRecord> Portfolio::getRecords()
+{
+    return records;
+}
@@ -0,0 +1,78 @@
+#include "Selection.hpp"
+
+#include <algorithm>
+
+Selection::Selection()
+{
+}
+
+Selection::Selection(std::string method, int tournamentSize, float selectionPressure)
+{
+    if (method == "rank")
+        this->method = RANK;
+    else if (method == "roulette")
+        this->method = ROULETTE;
+    else
+        this->method = TOURNAMENT;
+
+    this->tournamentSize = tournamentSize;
+    this->selectionPressure = selectionPressure;
+}
+
+void Selection::prepare(Individual **population, int populationCount)
+{
+    if (method == RANK)
+    {
+        // Probabilities depend only on the position, so the table is built once
+        if (aliasTable.size() == populationCount)
+            return;
+
+        weights.resize(populationCount);
+        const double s = selectionPressure;
+        for (int i = 0; i < populationCount; ++i)
+        {
+            // Position 0 holds the best individual
+            const int rank = populationCount - 1 - i;
+            weights[i] = (2.0 - s) / populationCount + 2.0 * rank * (s - 1.0) / (populationCount * (populationCount - 1.0));
+        }
+        aliasTable.build(weights);
+    }
+    else if (method == ROULETTE)
+    {
+        weights.resize(populationCount);
+        int worstWeight = 0;
+        for (int i = 0; i < populationCount; ++i)
+        {
+            worstWeight = std::max(worstWeight, population[i]->getPathWeight());
+        }
+        for (int i = 0; i < populationCount; ++i)
+        {
+            weights[i] = worstWeight - population[i]->getPathWeight() + 1.0;
+        }
+        aliasTable.build(weights);
+    }
+}
+
+int Selection::select(Individual **population, int populationCount, std::mt19937 &rng)
+{
+    if (method == RANK || method == ROULETTE)
+    {
+        return aliasTable.sample(rng);
+    }
+
+    int winner = rng() % populationCount;
+    for (int i = 1; i < tournamentSize; ++i)
+    {
+        const int contestant = rng() % populationCount;
+        if (population[contestant]->getPathWeight() < population[winner]->getPathWeight())
+        {
+            winner = contestant;
+        }
+    }
+    return winner;
+}
+
+bool Selection::isValidMethod(std::string method)
+{
+    return method == "tournament" || method == "rank" || method == "roulette";
+}
@@ -0,0 +1,124 @@
+#include "Solver.hpp"
+#include "Logger.hpp"
+
+#include <thread>
+#include <functional>
+
+#include "GeneticAlgorithm.hpp"
+#include "IslandModel.hpp"
+#include "SteadyStateGA.hpp"
+#include "IteratedLocalSearch.hpp"
+#include "HeldKarp.hpp"
+#include "LowerBound.hpp"
+#include "SymmetricTransform.hpp"
+#include "AllocationCounter.hpp"
+
+// Runs the engine selected in params
+static Path solveWithEngine(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound)
+{
+    if (params.engine == "steady_state")
+    {
+        SteadyStateGA alg(graph, params, lowerBound);
+        return alg.solveTSP();
+    }
+
+    if (params.engine == "lin_kernighan")
+    {
+        if (!graph->directed)
+        {
+            IteratedLocalSearch ils(graph, params, lowerBound);
+            Path path = ils.solveTSP();
+            LOG_INFO("solver", "Kicks: %llu, improving moves: %llu, average step: %.0f ns", ils.getKickCount(), ils.getImprovingMoves(), ils.getAverageStepNs());
+            return path;
+        }
+        LOG_WARN("solver", "Lin-Kernighan requires a symmetric instance, using the genetic algorithm.");
+    }
+
+    if (params.threadCount > 1)
+    {
+        IslandModel islands(graph, params, lowerBound);
+        return islands.solveTSP();
+    }
+
+    GeneticAlgorithm alg(graph, params, lowerBound);
+    return alg.solveTSP();
+}
+
+// Runs solve with the lower bound of params computed alongside (or without one), adds the bound and the gap to the path
+static Path solveWithLowerBound(GraphMatrix *graph, AlgorithmParams params, std::function<Path(LowerBound *)> solve)
+{
+    // Peak of the run (of the whole process so far if the kernel does not allow resetting it)
+    AllocationCounter::resetPeakRss();
+    if (!params.lowerBound)
+    {
+        Path path = solve(NULL);
+        path.profile.peakRssKb = AllocationCounter::getPeakRssKb();
+        return path;
+    }
+
+    LowerBound lowerBound(graph, params.lowerBoundIterations);
+    std::thread lowerBoundThread;
+    if (params.candidates == "alpha" && !graph->directed)
+    {
+        // The engine builds its candidate lists from the penalties, so they have to be ready first
+        lowerBound.compute();
+    }
+    else
+    {
+        lowerBoundThread = std::thread(&LowerBound::compute, &lowerBound);
+    }
+
+    Path path = solve(&lowerBound);
+
+    lowerBound.stop();
+    if (lowerBoundThread.joinable())
+    {
+        lowerBoundThread.join();
+    }
+
+    path.lowerBound = lowerBound.get();
+    path.gap = lowerBound.getGap(path.weight);
+    path.profile.peakRssKb = AllocationCounter::getPeakRssKb();
+    LOG_INFO("solver", "Lower bound: %i, gap: %.4f %%", path.lowerBound - graph->weightOffset, path.gap);
+    return path;
+}
+
+Path Solver::solve(GraphMatrix *graph, AlgorithmParams params)
+{
+    if (graph->getVertexCount() <= params.exactMaxSize)
+    {
+        HeldKarp exact(graph);
+        Path path = exact.solveTSP();
+        path.lowerBound = path.weight;
+        return path;
+    }
+
+    if (params.atspTransform && graph->directed)
+    {
+        SymmetricTransform transform(graph);
+        if (transform.isValid())
+        {
+            LOG_INFO("solver", "Solving the symmetric transformation of %i vertices.", transform.getSymmetricGraph()->getVertexCount());
+            return transform.mapBack(solve(transform.getSymmetricGraph(), params));
+        }
+        LOG_WARN("solver", "Weights are too large for the symmetric transformation, solving the asymmetric instance.");
+    }
+
+    return solveWithLowerBound(graph, params, [&](LowerBound *lowerBound)
+                               { return solveWithEngine(graph, params, lowerBound); });
+}
+
+Path Solver::solvePortfolio(GraphMatrix *graph, AlgorithmParams params, std::vector<AlgorithmParams> configurations, std::vector<PortfolioRecord> &records)
+{
+    return solveWithLowerBound(graph, params, [&](LowerBound *lowerBound)
+                               {
+                                   Portfolio portfolio(graph, configurations, params.maxExecutionTimeMs, params.threadCount, lowerBound);
+                                   Path path = portfolio.solveTSP();
+                                   records = portfolio.getRecords();
+                                   return path; });
+}
+
+bool Solver::isValidEngine(std::string engine)
+{
+    return engine == "generational" || engine == "steady_state" || engine == "lin_kernighan";
+}
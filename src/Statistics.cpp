@@ -0,0 +1,93 @@
+#include "Statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+double Statistics::quantile(std::vector<double> values, double q)
+{
+    if (values.empty())
+    {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    const double position = q * (values.size() - 1);
+    const size_t lower = (size_t)position;
+    const size_t upper = std::min(lower + 1, values.size() - 1);
+    return values[lower] + (position - lower) * (values[upper] - values[lower]);
+}
+
+double Statistics::median(std::vector<double> values)
+{
+    return quantile(values, 0.5);
+}
+
+std::vector<double> Statistics::filterOutliers(std::vector<double> values, double factor)
+{
+    const double q1 = quantile(values, 0.25);
+    const double q3 = quantile(values, 0.75);
+    const double low = q1 - factor * (q3 - q1);
+    const double high = q3 + factor * (q3 - q1);
+
+    std::vector<double> kept;
+    for (double value : values)
+    {
+        if (value >= low && value <= high)
+        {
+            kept.push_back(value);
+        }
+    }
+    return kept;
+}
+
+double Statistics::mannWhitneyGreater(std::vector<double> sample1, std::vector<double> sample2, double &u)
+{
+    u = 0.0;
+    const double n1 = sample1.size();
+    const double n2 = sample2.size();
+    if (n1 == 0 || n2 == 0)
+    {
+        return 1.0;
+    }
+
+    // Values of both samples with the sample they come from, ranked with the mean rank of ties
+    std::vector<std::pair<double, int>> joint;
+    for (double value : sample1)
+        joint.push_back({value, 1});
+    for (double value : sample2)
+        joint.push_back({value, 2});
+    std::sort(joint.begin(), joint.end());
+
+    const double n = joint.size();
+    double rankSum1 = 0.0;
+    double tieTerm = 0.0;
+    for (size_t first = 0; first < joint.size();)
+    {
+        size_t last = first;
+        while (last + 1 < joint.size() && joint[last + 1].first == joint[first].first)
+        {
+            last++;
+        }
+        const double rank = (first + last) / 2.0 + 1.0;
+        const double tieCount = last - first + 1;
+        tieTerm += tieCount * tieCount * tieCount - tieCount;
+        for (size_t i = first; i <= last; ++i)
+        {
+            if (joint[i].second == 1)
+            {
+                rankSum1 += rank;
+            }
+        }
+        first = last + 1;
+    }
+
+    u = rankSum1 - n1 * (n1 + 1) / 2.0;
+    const double mean = n1 * n2 / 2.0;
+    const double variance = n1 * n2 / 12.0 * ((n + 1) - tieTerm / (n * (n - 1)));
+    if (variance <= 0)
+    {
+        // All values are equal
+        return 1.0;
+    }
+    const double z = (u - mean - 0.5) / std::sqrt(variance);
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
@@ -0,0 +1,367 @@
+#include "SteadyStateGA.hpp"
+#include "Logger.hpp"
+
+#include <thread>
+#include <algorithm>
+#include <numeric>
+
+#include "GeneticAlgorithm.hpp"
+#include "Numa.hpp"
+
+// The clock is read once per this many children of a worker
+static const int TIME_CHECK_INTERVAL = 64;
+
+SteadyStateGA::SteadyStateGA(GraphMatrix *graph, AlgorithmParams params, LowerBound *lowerBound)
+{
+    this->params = params;
+    this->graph = graph;
+    this->lowerBound = lowerBound;
+    this->vertexCount = graph->getVertexCount();
+
+    this->population = new Slot[params.populationCount];
+    this->pathArena = new int[(size_t)params.populationCount * vertexCount];
+
+    for (int i = 0; i < params.populationCount; ++i)
+    {
+        population[i].path = pathArena + (size_t)i * vertexCount;
+    }
+
+    if (Crossover::needsCandidates(params.crossover, graph))
+    {
+        this->candidates = LowerBound::createCandidateList(graph, params, lowerBound);
+    }
+
+    if (params.crossover == "adaptive")
+    {
+        LOG_WARN("ssga", "Adaptive crossover is supported by the generational engine only, using ox1 crossover.");
+    }
+    if (params.adaptiveRates)
+    {
+        LOG_WARN("ssga", "Adaptive rates are supported by the generational engine only, using the fixed rates.");
+    }
+    if (params.selection != "tournament")
+    {
+        LOG_WARN("ssga", "The steady-state engine supports tournament selection only, using tournament selection.");
+    }
+    if (params.mutation != "inversion")
+    {
+        LOG_WARN("ssga", "The steady-state engine supports inversion mutation only, using inversion mutation.");
+    }
+    if (params.initialization != "random")
+    {
+        LOG_WARN("ssga", "The steady-state engine starts from random tours only, %s initialization is not used.", params.initialization.c_str());
+    }
+    if (params.localSearch != "none")
+    {
+        LOG_WARN("ssga", "Local search is supported by the generational engine only, %s is not used.", params.localSearch.c_str());
+    }
+    if (params.restart != "none")
+    {
+        LOG_WARN("ssga", "The steady-state engine does not detect stagnation, %s restarts are not used.", params.restart.c_str());
+    }
+    if (!params.traceFile.empty())
+    {
+        LOG_WARN("ssga", "The steady-state engine does not record the convergence trace.");
+    }
+    if (params.perfCounters)
+    {
+        LOG_WARN("ssga", "The steady-state engine does not read hardware performance counters.");
+    }
+
+    setMinError();
+}
+
+SteadyStateGA::~SteadyStateGA()
+{
+    delete[] population;
+    delete[] pathArena;
+    delete candidates;
+}
+
+void SteadyStateGA::setMinError()
+{
+    this->params.minError = GeneticAlgorithm::getMinError(graph->getOriginalVertexCount());
+}
+
+Path SteadyStateGA::solveTSP()
+{
+    timer.start();
+    // Allocations of the calling thread (the initialization)
+    PhaseProfile profile;
+    profile.startMemory();
+
+    baseSeed = params.seed != 0 ? params.seed : rand();
+
+    Timer initializationTimer;
+    initializationTimer.start();
+    initializePopulation();
+    const unsigned long initializationTimeNs = initializationTimer.getElapsedNs();
+
+    const int workerCount = std::max(1, params.threadCount);
+    std::vector<int> workerNodes;
+    const std::vector<int> cpus = Numa::assignCpus(workerCount, workerNodes);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < workerCount; ++i)
+    {
+        threads.emplace_back(&SteadyStateGA::runWorker, this, i, params.numaAware ? cpus[i] : -1);
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    // Workers run every phase at once, only the totals are profiled
+    const int weight = bestWeight.load();
+    profile.calls[PHASE_INITIALIZATION] = 1;
+    profile.timeNs[PHASE_INITIALIZATION] = initializationTimeNs;
+    profile.evaluations[PHASE_INITIALIZATION] = params.populationCount;
+    profile.evaluationCount = evaluationCount.load();
+    profile.runTimeNs = timer.getElapsedNs();
+    profile.finishMemory();
+    Path path(bestPath, weight, getPrd(weight));
+    path.profile = profile;
+    return path;
+}
+
+void SteadyStateGA::initializePopulation()
+{
+    std::mt19937 rng(baseSeed);
+
+    for (int i = 0; i < params.populationCount; ++i)
+    {
+        int *path = population[i].path;
+        std::iota(path, path + vertexCount, 0);
+        std::shuffle(path + 1, path + vertexCount, rng);
+
+        const int weight = evaluate(path);
+        population[i].weight.store(weight);
+        offerBest(path, weight);
+    }
+    evaluationCount += params.populationCount;
+}
+
+void SteadyStateGA::runWorker(int workerIndex, int cpu)
+{
+    Numa::pinCurrentThread(cpu);
+
+    Worker worker;
+    worker.rng.seed(baseSeed + workerIndex + 1);
+
+    std::vector<int> buffers(4 * (size_t)vertexCount);
+    worker.parent1 = buffers.data();
+    worker.parent2 = worker.parent1 + vertexCount;
+    worker.child1 = worker.parent2 + vertexCount;
+    worker.child2 = worker.child1 + vertexCount;
+    worker.crossover = Crossover::create(params.crossover, graph, candidates);
+
+    int childrenSinceCheck = 0;
+
+    while (true)
+    {
+        if (++childrenSinceCheck == TIME_CHECK_INTERVAL)
+        {
+            childrenSinceCheck = 0;
+            if (endConditionIsMet())
+            {
+                break;
+            }
+        }
+        else if (stop.load(std::memory_order_relaxed))
+        {
+            break;
+        }
+
+        const int index1 = tournament(worker, params.tournamentSize);
+        const int index2 = tournament(worker, params.tournamentSize);
+        if (index1 == index2)
+            continue;
+
+        int parent1Weight, parent2Weight;
+        if (!tryReadSlot(index1, worker.parent1, parent1Weight) || !tryReadSlot(index2, worker.parent2, parent2Weight))
+            continue;
+
+        int childWeights[2] = {parent1Weight, parent2Weight};
+        if (params.crossoverProbability > randomDouble(worker))
+        {
+            childWeights[0] = worker.crossover->crossover(worker.parent1, parent1Weight, worker.parent2, worker.child1, worker.rng);
+            childWeights[1] = worker.crossover->crossover(worker.parent2, parent2Weight, worker.parent1, worker.child2, worker.rng);
+            worker.evaluationCount += 2;
+        }
+        else
+        {
+            std::copy(worker.parent1, worker.parent1 + vertexCount, worker.child1);
+            std::copy(worker.parent2, worker.parent2 + vertexCount, worker.child2);
+        }
+
+        for (int c = 0; c < 2; ++c)
+        {
+            int *child = c == 0 ? worker.child1 : worker.child2;
+            int weight = childWeights[c];
+            // Only a mutated child has to be evaluated again
+            if (params.mutationProbability > randomDouble(worker))
+            {
+                inversionMutation(worker, child);
+                weight = evaluate(child);
+                worker.evaluationCount++;
+            }
+            offerBest(child, weight);
+
+            tryReplaceSlot(inverseTournament(worker, params.tournamentSize), child, weight);
+        }
+    }
+
+    evaluationCount += worker.evaluationCount;
+    delete worker.crossover;
+}
+
+int SteadyStateGA::tournament(Worker &worker, int tournamentSize)
+{
+    int winner = randomInt(worker, 0, params.populationCount - 1);
+    for (int i = 1; i < tournamentSize; ++i)
+    {
+        const int contestant = randomInt(worker, 0, params.populationCount - 1);
+        if (population[contestant].weight.load(std::memory_order_relaxed) < population[winner].weight.load(std::memory_order_relaxed))
+        {
+            winner = contestant;
+        }
+    }
+    return winner;
+}
+
+int SteadyStateGA::inverseTournament(Worker &worker, int tournamentSize)
+{
+    int loser = randomInt(worker, 0, params.populationCount - 1);
+    for (int i = 1; i < tournamentSize; ++i)
+    {
+        const int contestant = randomInt(worker, 0, params.populationCount - 1);
+        if (population[contestant].weight.load(std::memory_order_relaxed) > population[loser].weight.load(std::memory_order_relaxed))
+        {
+            loser = contestant;
+        }
+    }
+    return loser;
+}
+
+bool SteadyStateGA::tryReadSlot(int slotIndex, int *buffer, int &weight)
+{
+    Slot &slot = population[slotIndex];
+    if (slot.locked.exchange(true, std::memory_order_acquire))
+    {
+        return false;
+    }
+    std::copy(slot.path, slot.path + vertexCount, buffer);
+    weight = slot.weight.load(std::memory_order_relaxed);
+    slot.locked.store(false, std::memory_order_release);
+    return true;
+}
+
+bool SteadyStateGA::tryReplaceSlot(int slotIndex, int *child, int childWeight)
+{
+    Slot &slot = population[slotIndex];
+    if (childWeight >= slot.weight.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+    if (slot.locked.exchange(true, std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    // The slot could have been replaced in the meantime
+    const bool replace = childWeight < slot.weight.load(std::memory_order_relaxed);
+    if (replace)
+    {
+        std::copy(child, child + vertexCount, slot.path);
+        slot.weight.store(childWeight, std::memory_order_relaxed);
+    }
+    slot.locked.store(false, std::memory_order_release);
+    return replace;
+}
+
+void SteadyStateGA::offerBest(int *path, int weight)
+{
+    if (weight >= bestWeight.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(bestMutex);
+    if (weight < bestWeight.load(std::memory_order_relaxed))
+    {
+        bestPath.assign(path, path + vertexCount);
+        bestWeight.store(weight, std::memory_order_relaxed);
+    }
+}
+
+bool SteadyStateGA::endConditionIsMet()
+{
+    if (stop.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    if (timer.getElapsedMs() > (unsigned long)params.maxExecutionTimeMs)
+    {
+        stop.store(true);
+        return true;
+    }
+
+    if (getPrd(bestWeight.load(std::memory_order_relaxed)) <= params.minError)
+    {
+        stop.store(true);
+        return true;
+    }
+
+    if (lowerBound != NULL && lowerBound->getGap(bestWeight.load(std::memory_order_relaxed)) <= params.maxGap)
+    {
+        stop.store(true);
+        return true;
+    }
+
+    return false;
+}
+
+void SteadyStateGA::inversionMutation(Worker &worker, int *path)
+{
+    const int index1 = randomInt(worker, 0, vertexCount - 2);
+    const int index2 = randomInt(worker, index1 + 1, vertexCount - 1);
+    std::reverse(path + index1, path + index2 + 1);
+}
+
+int SteadyStateGA::evaluate(int *path)
+{
+    int sum = 0;
+    for (int i = 0; i < vertexCount - 1; ++i)
+    {
+        sum += graph->getWeight(path[i], path[i + 1]);
+    }
+    return sum + graph->getWeight(path[vertexCount - 1], path[0]);
+}
+
+int SteadyStateGA::randomInt(Worker &worker, int min, int max)
+{
+    return min + worker.rng() % (max - min + 1);
+}
+
+double SteadyStateGA::randomDouble(Worker &worker)
+{
+    return (double)worker.rng() / worker.rng.max();
+}
+
+unsigned long long SteadyStateGA::getEvaluationCount()
+{
+    return evaluationCount.load();
+}
+
+float SteadyStateGA::getError(int pathWeight)
+{
+    // Relative to the lower bound when the optimum is unknown
+    const int reference = graph->isOptimumKnown() || lowerBound == NULL ? graph->getOptimum() : lowerBound->get();
+    return (pathWeight - reference) / (float)(reference - graph->weightOffset);
+}
+
+float SteadyStateGA::getPrd(int pathWeight)
+{
+    return 100.0 * getError(pathWeight);
+}
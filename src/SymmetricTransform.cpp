@@ -0,0 +1,130 @@
+#include "SymmetricTransform.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <limits>
+
+SymmetricTransform::SymmetricTransform(GraphMatrix *graph)
+{
+    this->graph = graph;
+    this->vertexCount = graph->getVertexCount();
+    this->symmetricGraph = NULL;
+
+    // Nearest neighbor tour, an upper bound of the optimal weight
+    std::vector<char> visited(vertexCount, false);
+    long long upperBound = 0;
+    int current = 0;
+    visited[0] = true;
+    for (int step = 1; step < vertexCount; ++step)
+    {
+        int next = -1;
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            if (!visited[v] && (next < 0 || graph->getWeight(current, v) < graph->getWeight(current, next)))
+                next = v;
+        }
+        upperBound += graph->getWeight(current, next);
+        visited[next] = true;
+        current = next;
+    }
+    upperBound += graph->getWeight(current, 0);
+
+    // The heaviest tour of the symmetric instance has 2n edges of weight at most 2M
+    if ((upperBound + 1) * 4 * vertexCount > INT_MAX)
+    {
+        this->penalty = 0;
+        return;
+    }
+    this->penalty = upperBound + 1;
+
+    symmetricGraph = new GraphMatrix(2 * vertexCount);
+    symmetricGraph->directed = false;
+    symmetricGraph->weightOffset = vertexCount * penalty;
+    symmetricGraph->originalVertexCount = vertexCount;
+    if (graph->isOptimumKnown())
+    {
+        symmetricGraph->setOptimum(graph->getOptimum() + symmetricGraph->weightOffset);
+    }
+
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        for (int j = 0; j < vertexCount; ++j)
+        {
+            if (i == j)
+            {
+                symmetricGraph->addEdge(i, j, 0);
+                symmetricGraph->addEdge(vertexCount + i, vertexCount + j, 0);
+                symmetricGraph->addEdge(i, vertexCount + i, 0);
+                symmetricGraph->addEdge(vertexCount + i, i, 0);
+                continue;
+            }
+            symmetricGraph->addEdge(i, j, 2 * penalty);
+            symmetricGraph->addEdge(vertexCount + i, vertexCount + j, 2 * penalty);
+            symmetricGraph->addEdge(vertexCount + i, j, graph->getWeight(i, j) + penalty);
+            symmetricGraph->addEdge(j, vertexCount + i, graph->getWeight(i, j) + penalty);
+        }
+    }
+}
+
+SymmetricTransform::~SymmetricTransform()
+{
+    delete symmetricGraph;
+}
+
+bool SymmetricTransform::isValid()
+{
+    return symmetricGraph != NULL;
+}
+
+GraphMatrix *SymmetricTransform::getSymmetricGraph()
+{
+    return symmetricGraph;
+}
+
+int SymmetricTransform::getOriginalWeight(const std::vector<int> &path)
+{
+    int weight = 0;
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        weight += graph->getWeight(path[i], path[(i + 1) % vertexCount]);
+    }
+    return weight;
+}
+
+Path SymmetricTransform::mapBack(Path path)
+{
+    std::vector<int> vertices;
+    vertices.reserve(vertexCount);
+    for (int v : path.vertices)
+    {
+        if (v < vertexCount)
+            vertices.push_back(v);
+    }
+
+    // A tour alternating with the twins is read forwards when every vertex is followed by its twin
+    int weight = getOriginalWeight(vertices);
+    std::vector<int> reversed(vertices.rbegin(), vertices.rend());
+    const int reversedWeight = getOriginalWeight(reversed);
+    if (reversedWeight < weight)
+    {
+        vertices = reversed;
+        weight = reversedWeight;
+    }
+
+    float prd = 0.0;
+    if (graph->isOptimumKnown())
+    {
+        prd = 100.0 * (weight - graph->getOptimum()) / (float)graph->getOptimum();
+    }
+
+    Path result(vertices, weight, prd);
+    result.restartCount = path.restartCount;
+    result.profile = path.profile;
+    // Without a bound (not computed) the gap stays as it was
+    if (path.lowerBound > 0)
+    {
+        result.lowerBound = std::max(0, path.lowerBound - symmetricGraph->weightOffset);
+        result.gap = result.lowerBound > 0 ? 100.0 * (weight - result.lowerBound) / (float)result.lowerBound : std::numeric_limits<float>::infinity();
+    }
+    return result;
+}
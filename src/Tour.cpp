@@ -0,0 +1,13 @@
+#include "Tour.hpp"
+
+#include "ArrayTour.hpp"
+#include "TwoLevelList.hpp"
+
+Tour *Tour::create(int vertexCount, int twoLevelListMinSize)
+{
+    if (twoLevelListMinSize > 0 && vertexCount >= twoLevelListMinSize)
+    {
+        return new TwoLevelList(vertexCount);
+    }
+    return new ArrayTour(vertexCount);
+}
@@ -0,0 +1,364 @@
+#include "TwoLevelList.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+TwoLevelList::TwoLevelList()
+{
+}
+
+TwoLevelList::TwoLevelList(int vertexCount)
+{
+    this->vertexCount = vertexCount;
+    this->groupSize = std::max(4, (int)std::sqrt((double)vertexCount));
+
+    const int initialSegments = (vertexCount + groupSize - 1) / groupSize;
+    // Every reversal can add two segments, the list is rebuilt when there is no space left
+    this->segmentCapacity = 2 * initialSegments + 8;
+
+    nodeSegment.resize(vertexCount);
+    nodeRank.resize(vertexCount);
+    succ.resize(vertexCount);
+    pred.resize(vertexCount);
+
+    segmentFirst.resize(segmentCapacity);
+    segmentLast.resize(segmentCapacity);
+    segmentReversed.resize(segmentCapacity);
+    segmentNext.resize(segmentCapacity);
+    segmentPrev.resize(segmentCapacity);
+    segmentRank.resize(segmentCapacity);
+    freeSegments.reserve(segmentCapacity);
+
+    scratch.reserve(groupSize);
+    rebuildBuffer.resize(vertexCount);
+}
+
+void TwoLevelList::load(const int *path)
+{
+    freeSegments.clear();
+    for (int s = segmentCapacity - 1; s >= 0; --s)
+    {
+        freeSegments.push_back(s);
+    }
+
+    segmentCount = 0;
+    int previous = -1;
+
+    for (int start = 0; start < vertexCount; start += groupSize)
+    {
+        const int end = std::min(start + groupSize, vertexCount) - 1;
+        const int s = allocateSegment();
+
+        segmentFirst[s] = path[start];
+        segmentLast[s] = path[end];
+        segmentReversed[s] = false;
+
+        for (int i = start; i <= end; ++i)
+        {
+            const int v = path[i];
+            nodeSegment[v] = s;
+            nodeRank[v] = i - start;
+            succ[v] = i < end ? path[i + 1] : -1;
+            pred[v] = i > start ? path[i - 1] : -1;
+        }
+
+        if (previous == -1)
+        {
+            headSegment = s;
+        }
+        else
+        {
+            segmentNext[previous] = s;
+            segmentPrev[s] = previous;
+        }
+        previous = s;
+    }
+
+    segmentNext[previous] = headSegment;
+    segmentPrev[headSegment] = previous;
+
+    renumberSegments();
+}
+
+void TwoLevelList::store(int *path)
+{
+    int s = headSegment;
+    int i = 0;
+    do
+    {
+        for (int v = head(s);; v = segmentReversed[s] ? pred[v] : succ[v])
+        {
+            path[i++] = v;
+            if (v == tail(s))
+                break;
+        }
+        s = segmentNext[s];
+    } while (s != headSegment);
+}
+
+int TwoLevelList::head(int s)
+{
+    return segmentReversed[s] ? segmentLast[s] : segmentFirst[s];
+}
+
+int TwoLevelList::tail(int s)
+{
+    return segmentReversed[s] ? segmentFirst[s] : segmentLast[s];
+}
+
+int TwoLevelList::next(int v)
+{
+    const int s = nodeSegment[v];
+    if (v == tail(s))
+        return head(segmentNext[s]);
+    return segmentReversed[s] ? pred[v] : succ[v];
+}
+
+int TwoLevelList::prev(int v)
+{
+    const int s = nodeSegment[v];
+    if (v == head(s))
+        return tail(segmentPrev[s]);
+    return segmentReversed[s] ? succ[v] : pred[v];
+}
+
+long long TwoLevelList::key(int v)
+{
+    const int s = nodeSegment[v];
+    const int rank = segmentReversed[s] ? -nodeRank[v] : nodeRank[v];
+    return ((long long)segmentRank[s] << 32) + rank;
+}
+
+bool TwoLevelList::between(int a, int b, int c)
+{
+    const long long ka = key(a);
+    const long long kb = key(b);
+    const long long kc = key(c);
+
+    if (ka <= kc)
+        return ka <= kb && kb <= kc;
+    return kb >= ka || kb <= kc;
+}
+
+int TwoLevelList::allocateSegment()
+{
+    const int s = freeSegments.back();
+    freeSegments.pop_back();
+    segmentCount++;
+    return s;
+}
+
+void TwoLevelList::renumberSegments()
+{
+    int s = headSegment;
+    int rank = 0;
+    do
+    {
+        segmentRank[s] = rank++;
+        s = segmentNext[s];
+    } while (s != headSegment);
+}
+
+void TwoLevelList::splitBefore(int v)
+{
+    const int s = nodeSegment[v];
+    if (v == head(s))
+        return;
+
+    // Split between base neighbors x and y = succ[x]: part L = first..x, part R = y..last
+    const bool reversed = segmentReversed[s];
+    const int x = reversed ? v : pred[v];
+    const int y = reversed ? succ[v] : v;
+
+    // Size of L (walking from x back to the first vertex)
+    int sizeL = 1;
+    for (int u = x; u != segmentFirst[s]; u = pred[u])
+    {
+        sizeL++;
+    }
+    int sizeR = 1;
+    for (int u = y; u != segmentLast[s] && sizeR <= sizeL; u = succ[u])
+    {
+        sizeR++;
+    }
+
+    const int t = allocateSegment();
+    segmentReversed[t] = reversed;
+
+    // The smaller part moves to the new segment t
+    const bool moveL = sizeL <= sizeR;
+    if (moveL)
+    {
+        segmentFirst[t] = segmentFirst[s];
+        segmentLast[t] = x;
+        segmentFirst[s] = y;
+    }
+    else
+    {
+        segmentFirst[t] = y;
+        segmentLast[t] = segmentLast[s];
+        segmentLast[s] = x;
+    }
+    for (int u = segmentFirst[t];; u = succ[u])
+    {
+        nodeSegment[u] = t;
+        if (u == segmentLast[t])
+            break;
+    }
+
+    // L comes before R in the tour, unless the segment is reversed
+    const bool tBefore = moveL != reversed;
+    if (tBefore)
+    {
+        const int p = segmentPrev[s];
+        segmentNext[p] = t;
+        segmentPrev[t] = p;
+        segmentNext[t] = s;
+        segmentPrev[s] = t;
+        if (headSegment == s)
+            headSegment = t;
+    }
+    else
+    {
+        const int n = segmentNext[s];
+        segmentNext[s] = t;
+        segmentPrev[t] = s;
+        segmentNext[t] = n;
+        segmentPrev[n] = t;
+    }
+
+    renumberSegments();
+}
+
+void TwoLevelList::reverseInside(int s, int from, int to)
+{
+    // Endpoints in the base direction
+    const int a = segmentReversed[s] ? to : from;
+    const int b = segmentReversed[s] ? from : to;
+
+    const int before = a == segmentFirst[s] ? -1 : pred[a];
+    const int after = b == segmentLast[s] ? -1 : succ[b];
+
+    scratch.clear();
+    for (int u = a;; u = succ[u])
+    {
+        scratch.push_back(u);
+        if (u == b)
+            break;
+    }
+
+    // Reversed vertices take over the ranks of the path
+    const int size = scratch.size();
+    for (int i = 0; i < size / 2; ++i)
+    {
+        std::swap(nodeRank[scratch[i]], nodeRank[scratch[size - 1 - i]]);
+    }
+    std::reverse(scratch.begin(), scratch.end());
+
+    for (int i = 0; i < size; ++i)
+    {
+        const int u = scratch[i];
+        pred[u] = i > 0 ? scratch[i - 1] : before;
+        succ[u] = i + 1 < size ? scratch[i + 1] : after;
+    }
+
+    if (before == -1)
+        segmentFirst[s] = scratch[0];
+    else
+        succ[before] = scratch[0];
+
+    if (after == -1)
+        segmentLast[s] = scratch[size - 1];
+    else
+        pred[after] = scratch[size - 1];
+}
+
+void TwoLevelList::reverseSegments(int first, int last)
+{
+    if (segmentPrev[first] == last)
+    {
+        // The whole tour
+        int s = headSegment;
+        do
+        {
+            std::swap(segmentNext[s], segmentPrev[s]);
+            segmentReversed[s] = !segmentReversed[s];
+            s = segmentPrev[s];
+        } while (s != headSegment);
+    }
+    else
+    {
+        const int p = segmentPrev[first];
+        const int n = segmentNext[last];
+
+        scratch.clear();
+        for (int s = first;; s = segmentNext[s])
+        {
+            scratch.push_back(s);
+            if (s == last)
+                break;
+        }
+
+        int previous = p;
+        for (int i = scratch.size() - 1; i >= 0; --i)
+        {
+            const int s = scratch[i];
+            segmentReversed[s] = !segmentReversed[s];
+            segmentNext[previous] = s;
+            segmentPrev[s] = previous;
+            previous = s;
+        }
+        segmentNext[previous] = n;
+        segmentPrev[n] = previous;
+
+        if (std::find(scratch.begin(), scratch.end(), headSegment) != scratch.end())
+            headSegment = n;
+    }
+
+    renumberSegments();
+}
+
+void TwoLevelList::reverse(int from, int to)
+{
+    if (from == to)
+        return;
+
+    const int s = nodeSegment[from];
+    if (nodeSegment[to] == s && key(from) <= key(to))
+    {
+        reverseInside(s, from, to);
+        return;
+    }
+
+    // A reversal splits at most two segments
+    if (segmentCount + 2 > segmentCapacity)
+        rebuild();
+
+    const int afterTo = next(to);
+    splitBefore(from);
+    if (afterTo != from)
+        splitBefore(afterTo);
+
+    reverseSegments(nodeSegment[from], nodeSegment[to]);
+}
+
+void TwoLevelList::moveSegment(int first, int last, int after)
+{
+    const int afterLast = next(last);
+
+    // p [first..last] [afterLast..after] b -> p [after..afterLast] [last..first] b -> p [afterLast..after] [first..last] b
+    reverse(first, after);
+    reverse(after, afterLast);
+    reverse(last, first);
+}
+
+void TwoLevelList::rebuild()
+{
+    store(rebuildBuffer.data());
+    load(rebuildBuffer.data());
+}
+
+int TwoLevelList::getVertexCount()
+{
+    return vertexCount;
+}
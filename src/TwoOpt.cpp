@@ -0,0 +1,92 @@
+#include "TwoOpt.hpp"
+
+TwoOpt::TwoOpt(GraphMatrix *graph, CandidateList *candidates, int twoLevelListMinSize)
+{
+    this->graph = graph;
+    this->candidates = candidates;
+    this->vertexCount = graph->getVertexCount();
+
+    this->tour = Tour::create(vertexCount, twoLevelListMinSize);
+    this->queue = VertexQueue(vertexCount);
+}
+
+TwoOpt::~TwoOpt()
+{
+    delete tour;
+}
+
+int TwoOpt::optimize(int *path, int budget)
+{
+    if (vertexCount < 5)
+        return 0;
+
+    tour->load(path);
+
+    queue.clear();
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        queue.push(path[i]);
+    }
+
+    int totalGain = 0;
+    int moves = 0;
+
+    while (!queue.isEmpty())
+    {
+        const int t1 = queue.pop();
+        const int gain = improveVertex(t1);
+        if (gain > 0)
+        {
+            totalGain += gain;
+            moves++;
+            if (budget > 0 && moves >= budget)
+                break;
+        }
+    }
+
+    tour->store(path);
+    return totalGain;
+}
+
+int TwoOpt::improveVertex(int t1)
+{
+    const int candidateCount = candidates->getSize();
+
+    for (int direction = 0; direction < 2; ++direction)
+    {
+        const int t2 = direction == 0 ? tour->next(t1) : tour->prev(t1);
+        const int d12 = graph->getWeight(t1, t2);
+        const int *t2Candidates = candidates->get(t2);
+
+        for (int i = 0; i < candidateCount; ++i)
+        {
+            const int t3 = t2Candidates[i];
+            const int g1 = d12 - graph->getWeight(t2, t3);
+
+            // Candidates are sorted, so no further candidate can give a positive partial gain
+            if (g1 <= 0)
+                break;
+
+            const int t4 = direction == 0 ? tour->prev(t3) : tour->next(t3);
+            if (t3 == t1 || t4 == t1 || t4 == t2)
+                continue;
+
+            const int gain = g1 + graph->getWeight(t3, t4) - graph->getWeight(t4, t1);
+            if (gain > 0)
+            {
+                // Replace edges (t1, t2), (t4, t3) with (t2, t3), (t4, t1)
+                if (direction == 0)
+                    tour->reverse(t2, t4);
+                else
+                    tour->reverse(t1, t3);
+
+                queue.push(t1);
+                queue.push(t2);
+                queue.push(t3);
+                queue.push(t4);
+                return gain;
+            }
+        }
+    }
+    return 0;
+}
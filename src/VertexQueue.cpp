@@ -0,0 +1,49 @@
+#include "VertexQueue.hpp"
+
+VertexQueue::VertexQueue()
+{
+}
+
+VertexQueue::VertexQueue(int vertexCount)
+{
+    this->capacity = vertexCount;
+    this->queue.resize(vertexCount);
+    this->inQueue.resize(vertexCount);
+}
+
+void VertexQueue::clear()
+{
+    while (size > 0)
+    {
+        pop();
+    }
+    head = 0;
+}
+
+void VertexQueue::push(int v)
+{
+    if (inQueue[v])
+        return;
+
+    int tail = head + size;
+    if (tail >= capacity)
+        tail -= capacity;
+
+    queue[tail] = v;
+    size++;
+    inQueue[v] = true;
+}
+
+int VertexQueue::pop()
+{
+    const int v = queue[head];
+    head = head + 1 == capacity ? 0 : head + 1;
+    size--;
+    inQueue[v] = false;
+    return v;
+}
+
+bool VertexQueue::isEmpty()
+{
+    return size == 0;
+}
@@ -1,5 +1,7 @@
 #include "graphGenerator.hpp"
 
+#include <cmath>
+
 GraphMatrix *graphGenerator::getRandom(int verticesNum, int maxWeight)
 {
     GraphMatrix *graph = new GraphMatrix(verticesNum);
@@ -15,6 +17,32 @@ GraphMatrix *graphGenerator::getRandom(int verticesNum, int maxWeight)
     return graph;
 }
 
+GraphMatrix *graphGenerator::getRandomEuclidean(int verticesNum, int maxCoordinate)
+{
+    GraphMatrix *graph = new GraphMatrix(verticesNum);
+    graph->coordinatesX.resize(verticesNum);
+    graph->coordinatesY.resize(verticesNum);
+
+    for (int i = 0; i < verticesNum; ++i)
+    {
+        graph->coordinatesX[i] = getRandomInt(0, maxCoordinate);
+        graph->coordinatesY[i] = getRandomInt(0, maxCoordinate);
+    }
+
+    for (int i = 0; i < verticesNum; ++i)
+    {
+        for (int j = 0; j < verticesNum; ++j)
+        {
+            const double dx = graph->coordinatesX[i] - graph->coordinatesX[j];
+            const double dy = graph->coordinatesY[i] - graph->coordinatesY[j];
+            int weight = (j == i) ? -1 : (int)std::lround(std::sqrt(dx * dx + dy * dy));
+            graph->addEdge(i, j, weight);
+        }
+    }
+    graph->directed = false;
+    return graph;
+}
+
 int graphGenerator::getRandomInt(int min, int max)
 {
     return min + rand() % (max - min + 1);
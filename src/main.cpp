@@ -1,6 +1,8 @@
 #include "main.hpp"
 
 #include <iostream>
+#include <sstream>
+#include <thread>
 #include "graphGenerator.hpp"
 #include "FileUtils.hpp"
 #include "Timer.hpp"
@@ -8,6 +10,14 @@
 #include "GraphMatrix.hpp"
 #include "printColor.hpp"
 #include "Individual.hpp"
+#include "Solver.hpp"
+#include "Selection.hpp"
+#include "Crossover.hpp"
+#include "Construction.hpp"
+#include "IteratedLocalSearch.hpp"
+#include "HeldKarp.hpp"
+#include "Portfolio.hpp"
+#include "Logger.hpp"
 
 int main(void)
 {
@@ -18,7 +28,7 @@ int main(void)
     SI_Error rc = ini.LoadFile("settings.ini");
     if (rc < 0)
     {
-        printf("Could not load 'settings.ini' file\n");
+        LOG_ERROR("settings", "Could not load 'settings.ini' file");
         return 1;
     };
 
@@ -26,6 +36,24 @@ int main(void)
     const std::string inputDir = ini.GetValue("common", "input_dir", "./instances");
     const std::string outputDir = ini.GetValue("common", "output_dir", "./results");
 
+    LogLevel logLevel;
+    if (!Logger::parseLevel(ini.GetValue("log", "level", "info"), logLevel))
+    {
+        LOG_ERROR("settings", "Log level must be debug, info, warn, error or off");
+        return 1;
+    }
+    const std::string logFormat = ini.GetValue("log", "format", "human");
+    if (logFormat != "human" && logFormat != "json")
+    {
+        LOG_ERROR("settings", "Log format must be human or json");
+        return 1;
+    }
+    const std::string logFile = ini.GetValue("log", "file", "");
+    if (!Logger::start(logLevel, logFormat, logFile.empty() ? "" : outputDir + "/" + logFile))
+    {
+        LOG_WARN("main", "Could not open the log file, logging to the standard output.");
+    }
+
     if (mode == "file_instance_test")
     {
         fileInstanceTest(inputDir, outputDir);
@@ -34,9 +62,48 @@ int main(void)
     {
         randomInstanceTest(outputDir);
     }
+    else if (mode == "numa_benchmark")
+    {
+        numaBenchmark(inputDir, outputDir);
+    }
+    else if (mode == "opt_tour_check")
+    {
+        optTourCheck(inputDir, outputDir);
+    }
+    else if (mode == "crossover_benchmark")
+    {
+        crossoverBenchmark(inputDir, outputDir);
+    }
+    else if (mode == "crossover_throughput")
+    {
+        crossoverThroughput(inputDir, outputDir);
+    }
+    else if (mode == "initialization_benchmark")
+    {
+        initializationBenchmark(inputDir, outputDir);
+    }
+    else if (mode == "atsp_transform_benchmark")
+    {
+        atspTransformBenchmark(inputDir, outputDir);
+    }
+    else if (mode == "portfolio")
+    {
+        portfolio(inputDir, outputDir);
+    }
+    else if (mode == "regression")
+    {
+        // Non-zero exit code for scripts
+        if (!regression(inputDir, outputDir))
+            return 2;
+    }
+    else if (mode == "allocation_check")
+    {
+        if (!allocationCheck(inputDir, outputDir))
+            return 2;
+    }
     else
     {
-        printf("Wrong mode value.\n");
+        LOG_ERROR("settings", "Wrong mode value.");
         return 1;
     }
 
@@ -48,43 +115,486 @@ void fileInstanceTest(std::string inputDir, std::string outputDir)
     const int instanceCount = atoi(ini.GetValue("file_instance_test", "number_of_instances", "1"));
     const auto params = getAlorithmParams();
 
+    const std::string traceFile = ini.GetValue("trace", "file", "");
+    const std::string tracePrefix = traceFile.empty() ? "" : outputDir + "/" + traceFile;
+    std::vector<float> tttTargets;
+    std::stringstream targets(ini.GetValue("trace", "ttt_targets", ""));
+    for (std::string target; std::getline(targets, target, ',');)
+    {
+        if (target.find_first_not_of(" ") != std::string::npos)
+        {
+            tttTargets.push_back(std::stof(target));
+        }
+    }
+
     for (int i = 0; i < instanceCount; i++)
     {
-        const char *tag = ("instance_" + std::to_string(i)).c_str();
-        printf("\n%s:\n", tag);
+        const std::string tag = "instance_" + std::to_string(i);
+        LOG_INFO("main", "\n%s:", tag.c_str());
 
-        const std::string instanceName = ini.GetValue(tag, "instance", "UNKNOWN");
-        const std::string outputFile = ini.GetValue(tag, "output", "UNKNOWN");
-        const int iterCount = atoi(ini.GetValue(tag, "iterations", "1"));
+        const std::string instanceName = ini.GetValue(tag.c_str(), "instance", "UNKNOWN");
+        const std::string outputFile = ini.GetValue(tag.c_str(), "output", "UNKNOWN");
+        const int iterCount = atoi(ini.GetValue(tag.c_str(), "iterations", "1"));
 
         const std::string inputFilePath = inputDir + "/" + instanceName;
         const std::string outputFilePath = outputDir + "/" + outputFile;
 
-        printf("Input: %s\n", inputFilePath.c_str());
-        printf("Output: %s\n", outputFilePath.c_str());
-        printf("Iteration count: %i\n\n", iterCount);
+        LOG_INFO("main", "Input: %s", inputFilePath.c_str());
+        LOG_INFO("main", "Output: %s", outputFilePath.c_str());
+        LOG_INFO("main", "Iteration count: %i", iterCount);
 
         // Wczytanie grafu
         GraphMatrix *graph = FileUtils::loadGraph(inputFilePath);
         if (graph == NULL)
         {
-            printf("File not found.\n");
+            LOG_WARN("main", "File not found.");
             continue;
         }
         // printf("Graph read from file:\n");
         // graph->display();
 
-        Tests::fileInstanceTest(graph, iterCount, instanceName, outputFilePath, params);
+        Tests::fileInstanceTest(graph, iterCount, instanceName, outputFilePath, params, tracePrefix, tttTargets);
+
+        LOG_INFO("main", "Finished.");
+        LOG_INFO("main", "Results saved to file.");
+        delete graph;
+    }
+}
+
+void numaBenchmark(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "NUMA placement benchmark");
+    const int instanceCount = atoi(ini.GetValue("file_instance_test", "number_of_instances", "1"));
+    const std::string outputFile = ini.GetValue("numa_benchmark", "output", "numa_benchmark.csv");
+    const std::string outputFilePath = outputDir + "/" + outputFile;
+    const auto params = getAlorithmParams();
+
+    FileUtils::writeNumaBenchmarkHeader(outputFilePath);
+
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string tag = "instance_" + std::to_string(i);
+
+        const std::string instanceName = ini.GetValue(tag.c_str(), "instance", "UNKNOWN");
+        const int iterCount = atoi(ini.GetValue(tag.c_str(), "iterations", "1"));
+        const std::string inputFilePath = inputDir + "/" + instanceName;
+
+        LOG_INFO("main", "\n%s: %s", tag.c_str(), inputFilePath.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputFilePath);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+
+        Tests::numaBenchmark(graph, iterCount, instanceName, outputFilePath, params);
+        delete graph;
+    }
+    LOG_INFO("main", "Done. Saved to file.");
+}
+
+void optTourCheck(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "Optimal tour check");
+    const char *tag = "opt_tour_check";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int iterCount = atoi(ini.GetValue(tag, "iterations", "1"));
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "opt_tour_check.csv");
+    const auto params = getAlorithmParams();
+
+    FileUtils::writeOptTourCheckHeader(outputFilePath);
+
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string tourKey = "tour_" + std::to_string(i);
+
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+        const std::string tourName = ini.GetValue(tag, tourKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s, %s:", instanceName.c_str(), tourName.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+        if (graph->directed)
+        {
+            LOG_WARN("main", "Instance is not symmetric.");
+            delete graph;
+            continue;
+        }
+
+        const std::vector<int> optTour = FileUtils::loadTour(inputDir + "/" + tourName);
+        if (optTour.empty())
+        {
+            LOG_WARN("main", "Tour file not found.");
+            delete graph;
+            continue;
+        }
+
+        Tests::optTourCheck(graph, optTour, iterCount, instanceName, outputFilePath, params);
+        delete graph;
+    }
+    LOG_INFO("main", "Done. Saved to file.");
+}
+
+void crossoverBenchmark(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "Crossover benchmark");
+    const char *tag = "crossover_benchmark";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int iterCount = atoi(ini.GetValue(tag, "iterations", "1"));
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "crossover_benchmark.csv");
+    const auto params = getAlorithmParams();
+
+    FileUtils::writeCrossoverBenchmarkHeader(outputFilePath);
+
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s:", instanceName.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+        if (graph->directed)
+        {
+            LOG_WARN("main", "Instance is not symmetric.");
+            delete graph;
+            continue;
+        }
+
+        Tests::crossoverBenchmark(graph, iterCount, instanceName, outputFilePath, params);
+        delete graph;
+    }
+    LOG_INFO("main", "Done. Saved to file.");
+}
+
+void crossoverThroughput(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "Crossover throughput");
+    const char *tag = "crossover_throughput";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int childCount = atoi(ini.GetValue(tag, "children", "10000"));
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "crossover_throughput.csv");
+    const auto params = getAlorithmParams();
+
+    FileUtils::writeCrossoverThroughputHeader(outputFilePath);
+
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s:", instanceName.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+
+        Tests::crossoverThroughput(graph, childCount, instanceName, outputFilePath, params);
+        delete graph;
+    }
+    LOG_INFO("main", "Done. Saved to file.");
+}
+
+void initializationBenchmark(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "Initialization benchmark");
+    const char *tag = "initialization_benchmark";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int iterCount = atoi(ini.GetValue(tag, "iterations", "1"));
+    const int euclideanSize = atoi(ini.GetValue(tag, "euclidean_size", "0"));
+    const int referenceTimeMs = atoi(ini.GetValue(tag, "reference_time_ms", "5000"));
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "initialization_benchmark.csv");
+    const auto params = getAlorithmParams();
+
+    FileUtils::writeInitializationBenchmarkHeader(outputFilePath);
+
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s:", instanceName.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+
+        Tests::initializationBenchmark(graph, iterCount, instanceName, outputFilePath, params);
+        delete graph;
+    }
+
+    if (euclideanSize > 0)
+    {
+        // Instance files have no coordinates, the space filling curve is compared on a random Euclidean instance.
+        // Its optimum is unknown, so the result of the lin_kernighan engine is used instead.
+        const std::string instanceName = "euclidean" + std::to_string(euclideanSize);
+        GraphMatrix *graph = graphGenerator::getRandomEuclidean(euclideanSize, 100000);
+
+        AlgorithmParams referenceParams = params;
+        referenceParams.maxExecutionTimeMs = referenceTimeMs;
+        graph->setOptimum(1);
+        const Path reference = IteratedLocalSearch(graph, referenceParams).solveTSP();
+        graph->setOptimum(reference.weight);
+
+        LOG_INFO("main", "\n%s (reference weight %i):", instanceName.c_str(), reference.weight);
+        Tests::initializationBenchmark(graph, iterCount, instanceName, outputFilePath, params);
+        delete graph;
+    }
+    LOG_INFO("main", "Done. Saved to file.");
+}
+
+void atspTransformBenchmark(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "ATSP transformation benchmark");
+    const char *tag = "atsp_transform_benchmark";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int iterCount = atoi(ini.GetValue(tag, "iterations", "1"));
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "atsp_transform_benchmark.csv");
+    const auto params = getAlorithmParams();
+
+    FileUtils::writeAtspTransformBenchmarkHeader(outputFilePath);
+
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s:", instanceName.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+        if (!graph->directed)
+        {
+            LOG_WARN("main", "Instance is symmetric.");
+            delete graph;
+            continue;
+        }
+
+        Tests::atspTransformBenchmark(graph, iterCount, instanceName, outputFilePath, params);
+        delete graph;
+    }
+    LOG_INFO("main", "Done. Saved to file.");
+}
+
+void portfolio(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "Portfolio");
+    const char *tag = "portfolio";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int iterCount = atoi(ini.GetValue(tag, "iterations", "1"));
+    const int configurationCount = atoi(ini.GetValue(tag, "number_of_configurations", "0"));
+    const int threadCount = atoi(ini.GetValue(tag, "thread_count", "0"));
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "portfolio.csv");
+    auto params = getAlorithmParams();
+    params.threadCount = threadCount > 0 ? threadCount : std::max(1, (int)std::thread::hardware_concurrency());
+
+    std::vector<AlgorithmParams> configurations;
+    for (int c = 0; c < configurationCount; ++c)
+    {
+        configurations.push_back(getPortfolioConfiguration(params, "portfolio_configuration_" + std::to_string(c)));
+        LOG_INFO("main", "Configuration %i: %s", c, Portfolio::describe(configurations.back()).c_str());
+    }
+    if (configurations.empty())
+    {
+        LOG_WARN("main", "No configurations.");
+        return;
+    }
+
+    FileUtils::writePortfolioHeader(outputFilePath);
+
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s:", instanceName.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+
+        for (int run = 0; run < iterCount; ++run)
+        {
+            std::vector<PortfolioRecord> records;
+            const Path path = Solver::solvePortfolio(graph, params, configurations, records);
+            FileUtils::appendPortfolioResult(outputFilePath, instanceName, run, path, records);
+        }
+        delete graph;
+    }
+    LOG_INFO("main", "Done. Saved to file.");
+}
+
+bool regression(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "Regression");
+    const char *tag = "regression";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int seedCount = atoi(ini.GetValue(tag, "seeds", "10"));
+    const float targetPrd = atof(ini.GetValue(tag, "target_prd", "1.0"));
+    const double alpha = atof(ini.GetValue(tag, "alpha", "0.01"));
+    const double iqrFactor = atof(ini.GetValue(tag, "iqr_factor", "1.5"));
+    const bool writeBaseline = ini.GetBoolValue(tag, "write_baseline", false);
+    const std::string baselinePath = outputDir + "/" + ini.GetValue(tag, "baseline", "regression_baseline.csv");
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "regression.csv");
+    const std::string tracePath = outputDir + "/regression_trace.tmp";
+    const auto params = getAlorithmParams();
+
+    if (seedCount < 2)
+    {
+        LOG_ERROR("settings", "Invalid seeds value (at least 2).");
+        exit(0);
+    }
+
+    const std::vector<RegressionSample> baseline = writeBaseline ? std::vector<RegressionSample>() : FileUtils::loadRegressionBaseline(baselinePath);
+    if (baseline.empty())
+    {
+        LOG_INFO("main", "No baseline, the runs are saved as the baseline.");
+    }
+    else
+    {
+        FileUtils::writeRegressionHeader(outputFilePath);
+    }
+
+    std::vector<RegressionSample> samples;
+    bool passed = true;
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s:", instanceName.c_str());
+
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            // An instance that is not checked fails the check
+            LOG_ERROR("main", "File not found.");
+            passed = false;
+            continue;
+        }
+
+        const std::vector<RegressionSample> instanceSamples = Tests::regressionRuns(graph, instanceName, seedCount, targetPrd, tracePath, params);
+        samples.insert(samples.end(), instanceSamples.begin(), instanceSamples.end());
+        if (!baseline.empty())
+        {
+            passed = Tests::compareWithBaseline(instanceName, instanceSamples, baseline, alpha, iqrFactor, outputFilePath) && passed;
+        }
+        delete graph;
+    }
+
+    if (baseline.empty())
+    {
+        FileUtils::writeRegressionBaseline(baselinePath, samples);
+        LOG_INFO("main", "Done. Saved to file.");
+        if (!passed)
+            LOG_ERROR("main", "The baseline is missing instances.");
+        return passed;
+    }
+    if (passed)
+        LOG_INFO("main", "No regression.");
+    else
+        LOG_ERROR("main", "Regression check failed.");
+    return passed;
+}
+
+bool allocationCheck(std::string inputDir, std::string outputDir)
+{
+    LOG_INFO("main", "Allocation check");
+    const char *tag = "allocation_check";
+    const int instanceCount = atoi(ini.GetValue(tag, "number_of_instances", "0"));
+    const int warmupGenerations = atoi(ini.GetValue(tag, "warmup_generations", "100"));
+    const int generationCount = atoi(ini.GetValue(tag, "generations", "1000"));
+    const std::string outputFilePath = outputDir + "/" + ini.GetValue(tag, "output", "allocation_check.csv");
+    const auto params = getAlorithmParams();
+
+    FileUtils::writeAllocationCheckHeader(outputFilePath);
+
+    bool passed = true;
+    for (int i = 0; i < instanceCount; i++)
+    {
+        const std::string instanceKey = "instance_" + std::to_string(i);
+        const std::string instanceName = ini.GetValue(tag, instanceKey.c_str(), "UNKNOWN");
+
+        LOG_INFO("main", "\n%s:", instanceName.c_str());
 
-        printf("Finished.\n");
-        printf("Results saved to file.\n");
+        GraphMatrix *graph = FileUtils::loadGraph(inputDir + "/" + instanceName);
+        if (graph == NULL)
+        {
+            LOG_WARN("main", "File not found.");
+            continue;
+        }
+
+        passed = Tests::allocationCheck(graph, instanceName, warmupGenerations, generationCount, outputFilePath, params) && passed;
         delete graph;
     }
+    LOG_INFO("main", "Done. Saved to file.");
+    return passed;
+}
+
+AlgorithmParams getPortfolioConfiguration(AlgorithmParams params, std::string tag)
+{
+    const char *section = tag.c_str();
+    const float crossoverProbab = std::stof(ini.GetValue(section, "corssover_probability", std::to_string(params.crossoverProbability).c_str()));
+    const float mutationProbab = std::stof(ini.GetValue(section, "mutation_probability", std::to_string(params.mutationProbability).c_str()));
+    const int populationCount = atoi(ini.GetValue(section, "population_count", std::to_string(params.populationCount).c_str()));
+
+    // Validates the values and derives the sizes of the populations
+    const AlgorithmParams sized(params.maxExecutionTimeMs, params.maxItersWithoutImprovment, crossoverProbab, mutationProbab, populationCount);
+    params.crossoverProbability = sized.crossoverProbability;
+    params.mutationProbability = sized.mutationProbability;
+    params.populationCount = sized.populationCount;
+    params.nextGenPopulationCount = sized.nextGenPopulationCount;
+    params.matingPoolSize = sized.matingPoolSize;
+
+    params.engine = ini.GetValue(section, "engine", params.engine.c_str());
+    if (params.engine != "generational" && params.engine != "lin_kernighan")
+    {
+        LOG_ERROR("settings", "Portfolio engine must be generational or lin_kernighan");
+        exit(0);
+    }
+    params.crossover = ini.GetValue(section, "crossover", params.crossover.c_str());
+    if (!Crossover::isValidName(params.crossover) && params.crossover != "adaptive")
+    {
+        LOG_ERROR("settings", "Unknown crossover: %s", params.crossover.c_str());
+        exit(0);
+    }
+    params.localSearch = ini.GetValue(section, "local_search", params.localSearch.c_str());
+    if (params.localSearch != "none" && params.localSearch != "two_opt" && params.localSearch != "or_opt" && params.localSearch != "lin_kernighan")
+    {
+        LOG_ERROR("settings", "Unknown local search method: %s", params.localSearch.c_str());
+        exit(0);
+    }
+    return params;
 }
 
 void randomInstanceTest(std::string outputDir)
 {
-    printf("Random instance test\n\n");
+    LOG_INFO("main", "Random instance test");
     const char *tag = "random_instance_test";
     const auto params = getAlorithmParams();
 
@@ -116,6 +626,181 @@ AlgorithmParams getAlorithmParams()
         mutationProbab,
         populationCount);
 
+    params.engine = ini.GetValue(tag, "engine", "generational");
+    if (!Solver::isValidEngine(params.engine))
+    {
+        LOG_ERROR("settings", "Unknown engine: %s", params.engine.c_str());
+        exit(0);
+    }
+    params.exactMaxSize = atoi(ini.GetValue(tag, "exact_max_size", "24"));
+    if (params.exactMaxSize < 0 || params.exactMaxSize > HeldKarp::MAX_VERTEX_COUNT)
+    {
+        LOG_ERROR("settings", "Exact max size must be between 0 and %i", HeldKarp::MAX_VERTEX_COUNT);
+        exit(0);
+    }
+    params.atspTransform = ini.GetBoolValue(tag, "atsp_transform", false);
+    params.progressInterval = atoi(ini.GetValue(tag, "progress_interval", "0"));
+    if (params.progressInterval < 0)
+    {
+        LOG_ERROR("settings", "Progress interval must be at least 0");
+        exit(0);
+    }
+
+    params.perfCounters = ini.GetBoolValue(tag, "perf_counters", false);
+
+    params.traceInterval = atoi(ini.GetValue("trace", "interval", "100"));
+    params.traceCapacity = atoi(ini.GetValue("trace", "capacity", "100000"));
+    if (params.traceInterval < 1 || params.traceCapacity < 1)
+    {
+        LOG_ERROR("settings", "Trace interval and capacity must be at least 1");
+        exit(0);
+    }
+
+    params.selection = ini.GetValue(tag, "selection", "tournament");
+    params.tournamentSize = atoi(ini.GetValue(tag, "tournament_size", "2"));
+    params.selectionPressure = std::stof(ini.GetValue(tag, "selection_pressure", "1.5"));
+    params.crossover = ini.GetValue(tag, "crossover", "ox1");
+    if (!Crossover::isValidName(params.crossover) && params.crossover != "adaptive")
+    {
+        LOG_ERROR("settings", "Unknown crossover: %s", params.crossover.c_str());
+        exit(0);
+    }
+
+    const char *adaptiveTag = "adaptive";
+    params.adaptiveOperators.clear();
+    std::stringstream operators(ini.GetValue(adaptiveTag, "operators", "ox1,pmx,erx,eax"));
+    for (std::string name; std::getline(operators, name, ',');)
+    {
+        name.erase(0, name.find_first_not_of(" "));
+        name.erase(name.find_last_not_of(" ") + 1);
+        if (!Crossover::isValidName(name))
+        {
+            LOG_ERROR("settings", "Unknown adaptive crossover operator: %s", name.c_str());
+            exit(0);
+        }
+        params.adaptiveOperators.push_back(name);
+    }
+    params.adaptiveRates = ini.GetBoolValue(adaptiveTag, "rates", false);
+    const std::string adaptiveTrace = ini.GetValue(adaptiveTag, "trace", "");
+    params.adaptiveTrace = adaptiveTrace.empty() ? "" : std::string(ini.GetValue("common", "output_dir", "./results")) + "/" + adaptiveTrace;
+    params.mutation = ini.GetValue(tag, "mutation", "inversion");
+    if (params.mutation != "inversion" && params.mutation != "or_opt")
+    {
+        LOG_ERROR("settings", "Unknown mutation: %s", params.mutation.c_str());
+        exit(0);
+    }
+    if (!Selection::isValidMethod(params.selection))
+    {
+        LOG_ERROR("settings", "Unknown selection method: %s", params.selection.c_str());
+        exit(0);
+    }
+    if (params.tournamentSize < 1)
+    {
+        LOG_ERROR("settings", "Tournament size must be at least 1");
+        exit(0);
+    }
+    if (params.selectionPressure < 1.0 || params.selectionPressure > 2.0)
+    {
+        LOG_ERROR("settings", "Selection pressure must be between 1 and 2");
+        exit(0);
+    }
+
+    const char *initializationTag = "initialization";
+    params.initialization = ini.GetValue(initializationTag, "method", "random");
+    params.initializationShare = std::stof(ini.GetValue(initializationTag, "share", "0.25"));
+    params.initializationThreadCount = atoi(ini.GetValue(initializationTag, "thread_count", "0"));
+    if (!Construction::isValidMethod(params.initialization))
+    {
+        LOG_ERROR("settings", "Unknown initialization method: %s", params.initialization.c_str());
+        exit(0);
+    }
+    if (params.initializationShare < 0 || params.initializationShare > 1.0)
+    {
+        LOG_ERROR("settings", "Initialization share must be between 0 and 1");
+        exit(0);
+    }
+
+    const char *stagnationTag = "stagnation";
+    params.restart = ini.GetValue(stagnationTag, "restart", "none");
+    params.minDiversity = std::stof(ini.GetValue(stagnationTag, "min_diversity", "0.0"));
+    params.restartShare = std::stof(ini.GetValue(stagnationTag, "restart_share", "0.5"));
+    params.restartEliteCount = atoi(ini.GetValue(stagnationTag, "elite_count", "4"));
+    if (params.restart != "none" && params.restart != "partial_reinit" && params.restart != "catastrophe" && params.restart != "double_bridge")
+    {
+        LOG_ERROR("settings", "Unknown restart strategy: %s", params.restart.c_str());
+        exit(0);
+    }
+    if (params.restartShare < 0 || params.restartShare > 1.0)
+    {
+        LOG_ERROR("settings", "Restart share must be between 0 and 1");
+        exit(0);
+    }
+
+    const char *localSearchTag = "local_search";
+    params.localSearch = ini.GetValue(localSearchTag, "method", "none");
+    params.localSearchTarget = ini.GetValue(localSearchTag, "target", "offspring");
+    params.localSearchBudget = atoi(ini.GetValue(localSearchTag, "budget", "0"));
+    params.eliteCount = atoi(ini.GetValue(localSearchTag, "elite_count", "4"));
+    params.candidateListSize = atoi(ini.GetValue(localSearchTag, "candidate_list_size", "8"));
+    params.lkDepth = atoi(ini.GetValue(localSearchTag, "lk_depth", "5"));
+    params.twoLevelListMinSize = atoi(ini.GetValue(localSearchTag, "two_level_list_min_size", "10000"));
+    params.candidates = ini.GetValue(localSearchTag, "candidates", "nearest");
+    if (params.candidates != "nearest" && params.candidates != "alpha")
+    {
+        LOG_ERROR("settings", "Candidates must be nearest or alpha");
+        exit(0);
+    }
+    if (params.localSearch != "none" && params.localSearch != "two_opt" && params.localSearch != "or_opt" && params.localSearch != "lin_kernighan")
+    {
+        LOG_ERROR("settings", "Unknown local search method: %s", params.localSearch.c_str());
+        exit(0);
+    }
+    if (params.localSearchTarget != "offspring" && params.localSearchTarget != "elites")
+    {
+        LOG_ERROR("settings", "Local search target must be offspring or elites");
+        exit(0);
+    }
+    if (params.candidateListSize < 1)
+    {
+        LOG_ERROR("settings", "Candidate list size must be at least 1");
+        exit(0);
+    }
+    if (params.lkDepth < 1)
+    {
+        LOG_ERROR("settings", "Lin-Kernighan depth must be at least 1");
+        exit(0);
+    }
+    if (params.localSearchBudget < 0)
+    {
+        LOG_ERROR("settings", "Local search budget must be at least 0");
+        exit(0);
+    }
+    if (params.eliteCount < 0)
+    {
+        LOG_ERROR("settings", "Elite count must be at least 0");
+        exit(0);
+    }
+
+    const char *lowerBoundTag = "lower_bound";
+    params.lowerBound = ini.GetBoolValue(lowerBoundTag, "enabled", true);
+    params.lowerBoundIterations = atoi(ini.GetValue(lowerBoundTag, "iterations", "1000"));
+    params.maxGap = std::stof(ini.GetValue(lowerBoundTag, "max_gap", "0.0"));
+    if (params.candidates == "alpha" && !params.lowerBound)
+    {
+        LOG_ERROR("settings", "Alpha-nearness candidates need the lower bound");
+        exit(0);
+    }
+
+    const char *parallelTag = "parallel";
+    params.threadCount = atoi(ini.GetValue(parallelTag, "thread_count", "1"));
+    params.numaAware = ini.GetBoolValue(parallelTag, "numa_aware", true);
+    params.replicateGraph = ini.GetBoolValue(parallelTag, "replicate_graph", false);
+    if (params.threadCount < 1)
+    {
+        LOG_ERROR("settings", "Thread count must be at least 1");
+        exit(0);
+    }
+
     params.print();
     return params;
 }
@@ -1,30 +1,367 @@
 #include "tests.hpp"
+#include "Logger.hpp"
 
 #include <iostream>
 #include "Timer.hpp"
 #include "graphGenerator.hpp"
 #include "FileUtils.hpp"
-#include "printColor.hpp"
 #include "TestResult.hpp"
 #include "Path.hpp"
+#include "Solver.hpp"
+#include "IslandModel.hpp"
+#include "IteratedLocalSearch.hpp"
 #include "GeneticAlgorithm.hpp"
+#include "Crossover.hpp"
+#include "TwoOpt.hpp"
+#include "OrOpt.hpp"
+#include "ConvergenceTrace.hpp"
+#include "Statistics.hpp"
+#include "AllocationCounter.hpp"
 
-void Tests::fileInstanceTest(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params)
+#include <algorithm>
+
+void Tests::fileInstanceTest(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params,
+                             std::string tracePrefix, std::vector<float> tttTargets)
 {
     FileUtils::writeInstanceTestHeader(outputPath);
     Timer timer;
 
+    const std::string traceName = tracePrefix + "_" + instanceName.substr(0, instanceName.find_last_of('.'));
+    std::vector<std::string> traceFiles;
+
     for (int i = 0; i < iterCount; ++i)
     {
+        AlgorithmParams runParams = params;
+        if (!tracePrefix.empty())
+        {
+            runParams.traceFile = traceName + "_" + std::to_string(i) + ".csv";
+            traceFiles.push_back(runParams.traceFile);
+        }
+
         timer.start();
-        GeneticAlgorithm alg(graph, params);
-        Path path = alg.solveTSP();
+        Path path = Solver::solve(graph, runParams);
         const unsigned long elapsedTime = timer.getElapsedNs();
 
         TestResult testResult(instanceName, graph->getVertexCount(), elapsedTime, path, path.prd);
 
         FileUtils::appendTestResult(outputPath, testResult);
     }
+
+    if (!traceFiles.empty() && !tttTargets.empty())
+    {
+        timeToTarget(graph, traceFiles, tttTargets, traceName + "_ttt.csv");
+    }
+}
+
+void Tests::timeToTarget(GraphMatrix *graph, std::vector<std::string> traceFiles, std::vector<float> targets, std::string outputPath)
+{
+    if (!graph->isOptimumKnown())
+    {
+        LOG_WARN("tests", "The optimum is unknown, time to target is not computed.");
+        return;
+    }
+
+    std::vector<std::vector<TraceSample>> traces;
+    for (const std::string &traceFile : traceFiles)
+    {
+        traces.push_back(FileUtils::loadConvergenceTrace(traceFile));
+    }
+
+    FileUtils::writeTimeToTargetHeader(outputPath);
+    for (float target : targets)
+    {
+        const int targetWeight = (int)(graph->getOptimum() * (1.0 + target / 100.0));
+
+        // Runs that reached the target, by time
+        std::vector<std::pair<long long, int>> times;
+        for (int run = 0; run < (int)traces.size(); ++run)
+        {
+            const long long timeNs = ConvergenceTrace::timeToTarget(traces[run], targetWeight);
+            if (timeNs >= 0)
+            {
+                times.push_back({timeNs, run});
+            }
+        }
+        std::sort(times.begin(), times.end());
+
+        for (int i = 0; i < (int)times.size(); ++i)
+        {
+            // Probabilities over all runs, so runs that missed the target lower the curve
+            const double probability = (i + 0.5) / traces.size();
+            FileUtils::appendTimeToTarget(outputPath, target, targetWeight, times[i].second, times[i].first / 1e6, probability);
+        }
+        LOG_INFO("tests", "Target %.2f %%: reached in %zu of %zu runs", target, times.size(), traces.size());
+    }
+}
+
+void Tests::numaBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params)
+{
+    Timer timer;
+
+    for (int i = 0; i < iterCount; ++i)
+    {
+        for (bool numaAware : {false, true})
+        {
+            AlgorithmParams runParams = params;
+            runParams.numaAware = numaAware;
+            // Both placements get the same seeds
+            runParams.seed = params.seed != 0 ? params.seed : i + 1;
+
+            timer.start();
+            IslandModel islands(graph, runParams);
+            Path path = islands.solveTSP();
+            const unsigned long elapsedTime = timer.getElapsedNs();
+
+            const std::string placement = numaAware ? "numa_aware" : "naive";
+            LOG_INFO("tests", "%s: %lu ns, prd: %.4f", placement.c_str(), elapsedTime, path.prd);
+            islands.printNodeStatistics();
+
+            TestResult testResult(instanceName, graph->getVertexCount(), elapsedTime, path, path.prd);
+            FileUtils::appendNumaBenchmarkResult(outputPath, testResult, placement, runParams.threadCount, islands.getNodeStatistics());
+        }
+    }
+}
+
+void Tests::optTourCheck(GraphMatrix *graph, std::vector<int> optTour, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params)
+{
+    const int vertexCount = graph->getVertexCount();
+    if ((int)optTour.size() != vertexCount)
+    {
+        LOG_WARN("tests", "Tour has %i vertices, instance has %i.", (int)optTour.size(), vertexCount);
+        return;
+    }
+
+    int optTourWeight = 0;
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        optTourWeight += graph->getWeight(optTour[i], optTour[(i + 1) % vertexCount]);
+    }
+    LOG_INFO("tests", "Opt tour weight: %i, optimum in instance file: %i", optTourWeight, graph->getOptimum());
+
+    Timer timer;
+    for (int i = 0; i < iterCount; ++i)
+    {
+        timer.start();
+        IteratedLocalSearch ils(graph, params);
+        Path path = ils.solveTSP();
+        const unsigned long elapsedTime = timer.getElapsedNs();
+
+        LOG_INFO("tests", "weight: %i, gap to opt tour: %.4f %%, improving moves: %llu, average step: %.0f ns",
+                 path.weight,
+                 100.0 * (path.weight - optTourWeight) / optTourWeight,
+                 ils.getImprovingMoves(),
+                 ils.getAverageStepNs());
+
+        TestResult testResult(instanceName, vertexCount, elapsedTime, path, path.prd);
+        FileUtils::appendOptTourCheckResult(outputPath, testResult, optTourWeight, ils.getImprovingMoves(), ils.getAverageStepNs());
+    }
+}
+
+void Tests::crossoverBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params)
+{
+    const float targetPrd = GeneticAlgorithm::getMinError(graph->getVertexCount());
+    Timer timer;
+
+    for (int i = 0; i < iterCount; ++i)
+    {
+        // The adaptive crossover competes with every fixed operator
+        std::vector<std::string> crossovers = Crossover::getNames();
+        crossovers.push_back("adaptive");
+
+        for (const std::string &crossover : crossovers)
+        {
+            AlgorithmParams runParams = params;
+            runParams.crossover = crossover;
+            // All crossovers start from the same initial population
+            runParams.seed = params.seed != 0 ? params.seed + i : i + 1;
+
+            timer.start();
+            GeneticAlgorithm algorithm(graph, runParams);
+            Path path = algorithm.solveTSP();
+            const unsigned long elapsedTime = timer.getElapsedNs();
+
+            const bool reached = path.prd <= targetPrd;
+            LOG_INFO("tests", "%s: %lu ns, prd: %.4f, target %s", crossover.c_str(), elapsedTime, path.prd, reached ? "reached" : "not reached");
+
+            TestResult testResult(instanceName, graph->getVertexCount(), elapsedTime, path, path.prd);
+            FileUtils::appendCrossoverBenchmarkResult(outputPath, testResult, crossover, targetPrd, reached, algorithm.getEvaluationCount());
+        }
+    }
+}
+
+void Tests::crossoverThroughput(GraphMatrix *graph, int childCount, std::string instanceName, std::string outputPath, AlgorithmParams params)
+{
+    const int vertexCount = graph->getVertexCount();
+    const int parentCount = 32;
+    std::mt19937 rng(params.seed != 0 ? params.seed : 1);
+
+    // Parents are local optima (as in the memetic GA), so the quality of children is compared with good tours
+    CandidateList outCandidates(graph, params.candidateListSize);
+    CandidateList inCandidates(graph, params.candidateListSize, true);
+    std::vector<Individual *> parents(parentCount);
+    {
+        TwoOpt twoOpt(graph, &outCandidates, params.twoLevelListMinSize);
+        OrOpt orOpt(graph, &outCandidates, &inCandidates, params.twoLevelListMinSize);
+        for (int i = 0; i < parentCount; ++i)
+        {
+            parents[i] = new Individual(vertexCount, graph);
+            parents[i]->setRandomPath(rng);
+            parents[i]->updatePathWeight();
+            parents[i]->pathWeight -= graph->directed ? orOpt.optimize(parents[i]->path, 0) : twoOpt.optimize(parents[i]->path, 0);
+        }
+    }
+
+    // Neighbors of every vertex in both parents, for counting the inherited edges
+    std::vector<int> parentLinks(4 * vertexCount);
+    std::vector<int> child(vertexCount);
+    Timer timer;
+
+    for (const std::string &name : Crossover::getNames())
+    {
+        // eax would be replaced by ox1
+        if (graph->directed && Crossover::needsSymmetricGraph(name))
+            continue;
+
+        Crossover *crossover = Crossover::create(name, graph, &outCandidates);
+
+        unsigned long long elapsedNs = 0;
+        double parentsWeightSum = 0.0;
+        double childWeightSum = 0.0;
+        double weightRatioSum = 0.0;
+        int betterCount = 0;
+        unsigned long long inheritedEdges = 0;
+
+        for (int i = 0; i < childCount; ++i)
+        {
+            const int index1 = rng() % parentCount;
+            const int index2 = (index1 + 1 + rng() % (parentCount - 1)) % parentCount;
+            Individual *parent1 = parents[index1];
+            Individual *parent2 = parents[index2];
+
+            timer.start();
+            const int weight = crossover->crossover(parent1->path, parent1->getPathWeight(), parent2->path, child.data(), rng);
+            elapsedNs += timer.getElapsedNs();
+
+            const double parentsWeight = (parent1->getPathWeight() + parent2->getPathWeight()) / 2.0;
+            parentsWeightSum += parentsWeight;
+            childWeightSum += weight;
+            weightRatioSum += weight / parentsWeight;
+            if (weight < std::min(parent1->getPathWeight(), parent2->getPathWeight()))
+            {
+                betterCount++;
+            }
+
+            for (int k = 0; k < 2; ++k)
+            {
+                const int *path = k == 0 ? parent1->path : parent2->path;
+                for (int j = 0; j < vertexCount; ++j)
+                {
+                    parentLinks[4 * path[j] + 2 * k] = path[(j + vertexCount - 1) % vertexCount];
+                    parentLinks[4 * path[j] + 2 * k + 1] = path[(j + 1) % vertexCount];
+                }
+            }
+            for (int j = 0; j < vertexCount; ++j)
+            {
+                const int *links = parentLinks.data() + 4 * child[j];
+                const int next = child[(j + 1) % vertexCount];
+                if (links[0] == next || links[1] == next || links[2] == next || links[3] == next)
+                {
+                    inheritedEdges++;
+                }
+            }
+        }
+        delete crossover;
+
+        const double childrenPerSecond = childCount / (elapsedNs / 1e9);
+        const double betterPercent = 100.0 * betterCount / childCount;
+        const double inheritedPercent = 100.0 * inheritedEdges / ((double)childCount * vertexCount);
+        LOG_INFO("tests", "%s: %.0f children/s, child/parents weight: %.4f, better than both parents: %.2f %%, inherited edges: %.2f %%",
+                 name.c_str(), childrenPerSecond, weightRatioSum / childCount, betterPercent, inheritedPercent);
+
+        FileUtils::appendCrossoverThroughputResult(outputPath, instanceName, vertexCount, name, childCount, childrenPerSecond,
+                                                   parentsWeightSum / childCount, childWeightSum / childCount,
+                                                   weightRatioSum / childCount, betterPercent, inheritedPercent);
+    }
+
+    for (Individual *parent : parents)
+    {
+        delete parent;
+    }
+}
+
+void Tests::initializationBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params)
+{
+    const float targetPrd = GeneticAlgorithm::getMinError(graph->getVertexCount());
+    Timer timer;
+
+    for (int i = 0; i < iterCount; ++i)
+    {
+        for (std::string initialization : {"random", "nearest_neighbor", "greedy", "space_filling_curve"})
+        {
+            if (initialization == "space_filling_curve" && !graph->hasCoordinates())
+            {
+                LOG_INFO("tests", "%s: instance has no coordinates, skipped", initialization.c_str());
+                continue;
+            }
+
+            AlgorithmParams runParams = params;
+            runParams.initialization = initialization;
+            runParams.seed = params.seed != 0 ? params.seed + i : i + 1;
+
+            timer.start();
+            GeneticAlgorithm algorithm(graph, runParams);
+            Path path = algorithm.solveTSP();
+            const unsigned long elapsedTime = timer.getElapsedNs();
+
+            const bool reached = path.prd <= targetPrd;
+            LOG_INFO("tests", "%s: initialization %lu ns (prd %.4f), %lu ns, prd: %.4f, target %s", initialization.c_str(),
+                     algorithm.getInitializationTimeNs(), algorithm.getInitialPrd(), elapsedTime, path.prd, reached ? "reached" : "not reached");
+
+            TestResult testResult(instanceName, graph->getVertexCount(), elapsedTime, path, path.prd);
+            FileUtils::appendInitializationBenchmarkResult(outputPath, testResult, runParams, algorithm.getInitializationTimeNs(),
+                                                           algorithm.getInitialPrd(), targetPrd, reached, algorithm.getEvaluationCount());
+        }
+    }
+}
+
+void Tests::atspTransformBenchmark(GraphMatrix *graph, int iterCount, std::string instanceName, std::string outputPath, AlgorithmParams params)
+{
+    const float targetPrd = GeneticAlgorithm::getMinError(graph->getVertexCount());
+    Timer timer;
+
+    for (int i = 0; i < iterCount; ++i)
+    {
+        // Lin-Kernighan runs only on the transformation, the asymmetric instance falls back to the GA
+        for (std::string engine : {"generational", "lin_kernighan"})
+        {
+            for (bool transform : {false, true})
+            {
+                if (engine == "lin_kernighan" && !transform)
+                    continue;
+
+                AlgorithmParams runParams = params;
+                runParams.engine = engine;
+                runParams.atspTransform = transform;
+                // The transformation is meant for the operators of symmetric instances
+                if (transform && engine == "generational")
+                {
+                    runParams.crossover = "eax";
+                }
+                runParams.seed = params.seed != 0 ? params.seed + i : i + 1;
+
+                timer.start();
+                Path path = Solver::solve(graph, runParams);
+                const unsigned long elapsedTime = timer.getElapsedNs();
+
+                const bool reached = path.prd <= targetPrd;
+                LOG_INFO("tests", "%s, %s, %s: %lu ns, prd: %.4f, lower bound: %i, target %s", transform ? "symmetric" : "asymmetric", engine.c_str(),
+                         engine == "lin_kernighan" ? "-" : runParams.crossover.c_str(), elapsedTime, path.prd, path.lowerBound, reached ? "reached" : "not reached");
+
+                TestResult testResult(instanceName, graph->getVertexCount(), elapsedTime, path, path.prd);
+                FileUtils::appendAtspTransformBenchmarkResult(outputPath, testResult, runParams, targetPrd, reached);
+            }
+        }
+    }
 }
 
 void Tests::randomInstanceTest(int minSize, int maxSize, int iterCountPerInstance, int instanceCountPerSize, std::string outputPath, AlgorithmParams params)
@@ -32,7 +369,7 @@ void Tests::randomInstanceTest(int minSize, int maxSize, int iterCountPerInstanc
     FileUtils::writeRandomInstanceTestHeader(outputPath);
     Timer timer;
     GraphMatrix *graph;
-    printf("%i, %i\n", iterCountPerInstance, instanceCountPerSize);
+    LOG_INFO("tests", "%i, %i", iterCountPerInstance, instanceCountPerSize);
 
     for (int vertexCount = minSize; vertexCount <= maxSize; vertexCount++)
     {
@@ -46,8 +383,7 @@ void Tests::randomInstanceTest(int minSize, int maxSize, int iterCountPerInstanc
             for (int j = 0; j < iterCountPerInstance; ++j)
             {
                 timer.start();
-                GeneticAlgorithm alg(graph, params);
-                Path path = alg.solveTSP();
+                Path path = Solver::solve(graph, params);
                 averageTime += timer.getElapsedNs();
             }
             delete graph;
@@ -56,7 +392,7 @@ void Tests::randomInstanceTest(int minSize, int maxSize, int iterCountPerInstanc
         averageTime /= iterCountPerInstance * instanceCountPerSize;
         FileUtils::appendRandomInstanceTestResult(outputPath, vertexCount, averageTime);
     }
-    printf("Done. Saved to file.\n");
+    LOG_INFO("tests", "Done. Saved to file.");
 }
 
 void Tests::testAlgorithm(std::vector<std::string> instances, AlgorithmParams params)
@@ -67,22 +403,158 @@ void Tests::testAlgorithm(std::vector<std::string> instances, AlgorithmParams pa
         GraphMatrix *graph;
         graph = FileUtils::loadGraph(instanceName);
 
-        GeneticAlgorithm alg(graph, params);
-        Path path = alg.solveTSP();
+        Path path = Solver::solve(graph, params);
         const bool correctRes = path.weight == graph->optimum;
 
-        printf("%14s", instanceName.c_str());
-
         if (correctRes)
         {
-            printColor(" PASS\n", GREEN, BOLD, BOLD);
+            LOG_INFO("tests", "%14s PASS", instanceName.c_str());
         }
         else
         {
-            printColor(" FAIL\n", RED, BOLD, BOLD);
+            LOG_WARN("tests", "%14s FAIL", instanceName.c_str());
         }
 
         delete graph;
         graph = NULL;
     }
 }
+
+std::vector<RegressionSample> Tests::regressionRuns(GraphMatrix *graph, std::string instanceName, int seedCount, float targetPrd,
+                                                   std::string traceFile, AlgorithmParams params)
+{
+    std::vector<RegressionSample> samples;
+    if (!graph->isOptimumKnown())
+    {
+        LOG_WARN("tests", "The optimum is unknown, the time to target is the time limit.");
+    }
+    const int targetWeight = (int)(graph->getOptimum() * (1.0 + targetPrd / 100.0));
+    Timer timer;
+
+    for (int seed = 1; seed <= seedCount; ++seed)
+    {
+        AlgorithmParams runParams = params;
+        runParams.seed = seed;
+        runParams.traceFile = traceFile;
+
+        timer.start();
+        Path path = Solver::solve(graph, runParams);
+        const double elapsedMs = timer.getElapsedNs() / 1e6;
+
+        // Exact solutions leave no trace, runs that missed the target count as the time limit
+        long long timeNs = graph->isOptimumKnown() ? ConvergenceTrace::timeToTarget(FileUtils::loadConvergenceTrace(traceFile), targetWeight) : -1;
+        double timeToTargetMs = timeNs >= 0 ? timeNs / 1e6 : params.maxExecutionTimeMs;
+        if (timeNs < 0 && graph->isOptimumKnown() && path.prd <= targetPrd)
+        {
+            timeToTargetMs = elapsedMs;
+        }
+        remove(traceFile.c_str());
+
+        RegressionSample sample;
+        sample.instanceName = instanceName;
+        sample.seed = seed;
+        sample.timeToTargetMs = timeToTargetMs;
+        sample.prd = path.prd;
+        samples.push_back(sample);
+        LOG_INFO("tests", "seed %i: time to target %.1f ms, prd: %.4f", seed, timeToTargetMs, path.prd);
+    }
+    return samples;
+}
+
+bool Tests::compareWithBaseline(std::string instanceName, std::vector<RegressionSample> samples, std::vector<RegressionSample> baseline,
+                                double alpha, double iqrFactor, std::string outputPath)
+{
+    bool passed = true;
+    for (std::string metric : {"time to target [ms]", "error [%]"})
+    {
+        const bool time = metric == "time to target [ms]";
+        std::vector<double> current;
+        std::vector<double> reference;
+        for (const RegressionSample &sample : samples)
+        {
+            current.push_back(time ? sample.timeToTargetMs : sample.prd);
+        }
+        for (const RegressionSample &sample : baseline)
+        {
+            if (sample.instanceName == instanceName)
+            {
+                reference.push_back(time ? sample.timeToTargetMs : sample.prd);
+            }
+        }
+        if (reference.empty())
+        {
+            LOG_ERROR("tests", "%s is not in the baseline.", instanceName.c_str());
+            return false;
+        }
+
+        current = Statistics::filterOutliers(current, iqrFactor);
+        reference = Statistics::filterOutliers(reference, iqrFactor);
+
+        // Larger times and errors are worse
+        double u;
+        const double pValue = Statistics::mannWhitneyGreater(current, reference, u);
+        const double currentMedian = Statistics::median(current);
+        const double referenceMedian = Statistics::median(reference);
+        const bool regression = pValue < alpha && currentMedian > referenceMedian;
+        passed = passed && !regression;
+
+        LOG_INFO("tests", "%s: baseline median %.4f, current median %.4f, p-value %.4f%s", metric.c_str(), referenceMedian, currentMedian, pValue,
+                 regression ? " - REGRESSION" : "");
+        FileUtils::appendRegressionResult(outputPath, instanceName, metric, reference.size(), current.size(), referenceMedian, currentMedian,
+                                          u, pValue, regression);
+    }
+    return passed;
+}
+
+bool Tests::allocationCheck(GraphMatrix *graph, std::string instanceName, int warmupGenerations, int generationCount, std::string outputPath,
+                            AlgorithmParams params)
+{
+    GeneticAlgorithm algorithm(graph, params);
+    algorithm.start();
+    bool ended = false;
+    for (int i = 0; i < warmupGenerations && !ended; ++i)
+    {
+        ended = algorithm.step();
+    }
+
+    const PhaseProfile warmup = algorithm.getProfile();
+    const unsigned long long startAllocations = AllocationCounter::getAllocations();
+    const unsigned long long startBytes = AllocationCounter::getAllocatedBytes();
+    int checkedCount = 0;
+    while (checkedCount < generationCount && !ended)
+    {
+        ended = algorithm.step();
+        checkedCount++;
+    }
+    const unsigned long long allocations = AllocationCounter::getAllocations() - startAllocations;
+    const unsigned long long bytes = AllocationCounter::getAllocatedBytes() - startBytes;
+
+    std::vector<unsigned long long> phaseAllocations(PHASE_COUNT);
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        phaseAllocations[phase] = algorithm.getProfile().allocations[phase] - warmup.allocations[phase];
+        if (phaseAllocations[phase] > 0)
+        {
+            LOG_WARN("tests", "%s: %llu allocations (%llu B)", PhaseProfile::getName((Phase)phase), phaseAllocations[phase],
+                     algorithm.getProfile().allocatedBytes[phase] - warmup.allocatedBytes[phase]);
+        }
+    }
+    algorithm.finish();
+
+    if (checkedCount < generationCount)
+    {
+        LOG_WARN("tests", "The run ended after %i of %i checked generations.", checkedCount, generationCount);
+    }
+    const bool passed = allocations == 0;
+    if (passed)
+    {
+        LOG_INFO("tests", "No allocations in %i generations.", checkedCount);
+    }
+    else
+    {
+        LOG_ERROR("tests", "%llu allocations (%llu B) in %i generations.", allocations, bytes, checkedCount);
+    }
+    FileUtils::appendAllocationCheckResult(outputPath, instanceName, graph->getVertexCount(), warmupGenerations, checkedCount, allocations, bytes,
+                                           phaseAllocations);
+    return passed;
+}